@@ -162,6 +162,17 @@ namespace Go
 	    /// difference vector and surface normal
 	    bool isInside(const Point& pnt, double& dist, double& ang) const;
 
+	    /// Classify many points with respect to this body. Each
+	    /// shell is classified with its ray casting hierarchy,
+	    /// which is kept between calls, see
+	    /// SurfaceModel::classifyPoints(). Points in voids are
+	    /// classified as outside.
+	    /// \param pnts the points to classify
+	    /// \retval result 1 if the point is inside, 0 if it lies on
+	    /// the boundary within the gap tolerance, -1 if it is outside
+	    void classifyPoints(const std::vector<Point>& pnts,
+				std::vector<int>& result) const;
+
 	    /// Find the shell containing a given face (if any)
 	    shared_ptr<SurfaceModel> getShell(ftSurface* face) const;
 
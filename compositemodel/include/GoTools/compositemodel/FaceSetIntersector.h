@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _FACESETINTERSECTOR_H
+#define _FACESETINTERSECTOR_H
+
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <utility>
+
+namespace Go
+{
+
+class ftSurface;
+class SurfaceModel;
+class ParamSurface;
+class BoundedSurface;
+class CurveOnSurface;
+
+/// The intersection curves between two faces, see FaceSetIntersector.
+struct GO_API FacePairIntersection
+{
+    /// Status of the intersection computation of a face pair
+    enum Status
+    {
+	COMPLETED,      ///< All intersections are computed
+	LIMIT_REACHED,  ///< Stopped by the time or subdivision limit, 
+	                ///< the curves may be incomplete
+	FAILED          ///< The computation failed, no curves
+    };
+
+    /// Index of the first face in the first face set
+    int face1_;
+    /// Index of the second face in the second face set
+    int face2_;
+    /// The intersection curves lying in the first face
+    std::vector<shared_ptr<CurveOnSurface> > int_cv1_;
+    /// The corresponding curves lying in the second face
+    std::vector<shared_ptr<CurveOnSurface> > int_cv2_;
+    /// Outcome of the computation
+    Status status_;
+    /// Wall clock time spent on the pair, in seconds
+    double time_;
+};
+
+/// FaceSetIntersector computes the intersection curves between all
+/// pairs of faces in two face sets, or between the faces of one set.
+/// Candidate pairs are found in a broad phase where the bounding boxes 
+/// of the faces are organized in a bounding volume hierarchy, and the 
+/// pairs with overlapping boxes are filtered by a test on rotated 
+/// boxes adapted to the surfaces. The broad phase runs in parallel if
+/// OpenMP is enabled. The candidate pairs are intersected one by one
+/// by SfSfIntersector, and the curves are restricted to the trimmed
+/// domains of the faces. The effort spent on each pair may be
+/// limited, see setLimits(), so that a few complex configurations do
+/// not dominate the computation.
+class GO_API FaceSetIntersector
+{
+ public:
+    /// Constructor. Intersect the faces of one set with each other.
+    /// \param faces the faces
+    /// \param tol geometric tolerance
+    FaceSetIntersector(const std::vector<shared_ptr<ftSurface> >& faces,
+		       double tol);
+
+    /// Constructor. Intersect the faces of one set with the faces of
+    /// another set.
+    /// \param faces1 the first face set
+    /// \param faces2 the second face set
+    /// \param tol geometric tolerance
+    FaceSetIntersector(const std::vector<shared_ptr<ftSurface> >& faces1,
+		       const std::vector<shared_ptr<ftSurface> >& faces2,
+		       double tol);
+
+    /// Constructor. Intersect the faces of two surface models, or the
+    /// faces of one model with each other if model2 is a null pointer.
+    /// The gap tolerance of the first model is used.
+    FaceSetIntersector(shared_ptr<SurfaceModel> model1,
+		       shared_ptr<SurfaceModel> model2 
+		       = shared_ptr<SurfaceModel>());
+
+    /// Destructor
+    ~FaceSetIntersector();
+
+    /// Limit the effort spent on each face pair, see 
+    /// Intersector::setLimits(). A pair stopped by a limit is reported
+    /// with the status LIMIT_REACHED and the curves found so far.
+    /// \param max_seconds maximum wall clock time per pair, 0 means
+    /// no limit
+    /// \param max_subdivisions maximum number of subdivision steps per
+    /// pair, 0 means no limit
+    void setLimits(double max_seconds, int max_subdivisions)
+    {
+	max_seconds_ = max_seconds;
+	max_subdivisions_ = max_subdivisions;
+    }
+
+    /// When one face set is intersected with itself, decide whether
+    /// faces sharing an edge should be intersected. The default is
+    /// false, as such faces always meet along the common edge.
+    void setIncludeAdjacent(bool include_adjacent)
+    { include_adjacent_ = include_adjacent; }
+
+    /// Find the face pairs that may intersect (broad phase)
+    /// \retval pairs the candidate pairs, the first index refers to
+    /// the first face set and the second to the second set
+    void candidatePairs(std::vector<std::pair<int, int> >& pairs);
+
+    /// Compute the intersection curves of all candidate pairs
+    /// \retval result one entry for each candidate pair where 
+    /// intersection curves are found or the computation did not
+    /// complete, sorted by the face indices
+    void compute(std::vector<FacePairIntersection>& result);
+
+    /// The number of face pairs with overlapping bounding boxes in the
+    /// last computation of candidate pairs
+    int numBoxPairs() const
+    { return nmb_box_pairs_; }
+
+    /// The number of these pairs that passed the rotated box test
+    int numCandidatePairs() const
+    { return nmb_candidates_; }
+
+ private:
+    // A face prepared for intersection. The surfaces are shared by
+    // all pairs the face takes part in. The pairs are intersected one
+    // by one, see compute()
+    struct FaceInfo
+    {
+	shared_ptr<BoundedSurface> bd_sf_;  // The face as a trimmed surface
+	shared_ptr<ParamSurface> int_sf_;   // Underlying surface restricted
+	                                    // to the trimmed domain
+	bool prepared_;
+    };
+
+    struct Node
+    {
+	double low_[3], high_[3];
+	int first_;  // First face of a leaf, the right child of an inner node
+	int count_;  // Number of faces in a leaf, 0 for an inner node
+    };
+
+    std::vector<shared_ptr<ftSurface> > faces1_;
+    std::vector<shared_ptr<ftSurface> > faces2_;
+    bool self_;
+    double tol_;
+    double max_seconds_;
+    int max_subdivisions_;
+    bool include_adjacent_;
+    int nmb_box_pairs_;
+    int nmb_candidates_;
+
+    // Boxes of the faces, low and high, six per face. The hierarchy
+    // is built over the boxes of the second face set
+    std::vector<double> boxes1_;
+    std::vector<double> boxes2_;
+    std::vector<int> perm_;
+    std::vector<Node> nodes_;
+
+    std::vector<FaceInfo> info1_;
+    std::vector<FaceInfo> info2_;  // Not used when self_ is true
+
+    void makeHierarchy();
+
+    int buildNode(int first, int last);
+
+    void boxPairs(std::vector<std::pair<int, int> >& pairs) const;
+
+    const FaceInfo& faceInfo(int set, int idx) const
+    { return (set == 0 || self_) ? info1_[idx] : info2_[idx]; }
+
+    void prepareFace(int set, int idx);
+
+    bool rotatedBoxOverlap(int idx1, int idx2) const;
+
+    void intersectPair(int idx1, int idx2, 
+		       FacePairIntersection& result) const;
+};
+
+} // namespace Go
+
+#endif // _FACESETINTERSECTOR_H
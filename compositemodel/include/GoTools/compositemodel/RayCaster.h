@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _RAYCASTER_H
+#define _RAYCASTER_H
+
+#include "GoTools/compositemodel/ftPoint.h"
+#include "GoTools/geometry/BezierSurfaceCache.h"
+#include "GoTools/utils/Point.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+class ftSurface;
+class ParamSurface;
+class SplineSurface;
+class CurveBoundedDomain;
+
+/// Used internally in SurfaceModel. RayCaster computes the first
+/// intersection between rays and a set of faces. The faces are split
+/// in Bezier patches, and the boxes of the patches are organized in a
+/// bounding volume hierarchy built with the surface area heuristic.
+/// Rays are traversed in small packets. When a ray enters a patch box,
+/// the intersection is computed by Newton iteration on the patch,
+/// seeded from a coarse triangulation of the patch, and the result is
+/// tested against the trimming curves of the face. Faces without a
+/// spline representation, like cylinders and spheres, are intersected
+/// through a spline approximation, and the intersection points are
+/// mapped to the parametrization of the face by closest point
+/// computation.
+/// The rays are half lines. Segments where a ray lies in a face are
+/// not reported, use SurfaceModel::hit() for such configurations.
+/// The query functions are const and may be called concurrently.
+class GO_API RayCaster
+{
+ public:
+    /// Constructor
+    /// \param faces the faces to intersect
+    /// \param tol geometric tolerance for the intersection points
+    RayCaster(const std::vector<ftSurface*>& faces, double tol);
+
+    /// Destructor
+    ~RayCaster();
+
+    /// The number of Bezier patches in the hierarchy
+    int numPatches() const
+    { return (int)patches_.size(); }
+
+    /// The first intersection between a ray and the faces
+    /// \param point start point of the ray
+    /// \param dir ray direction
+    /// \retval result the intersection point closest to point
+    /// \return whether the ray hits any face
+    bool hit(const Point& point, const Point& dir, ftPoint& result) const;
+
+    /// The first intersection between a number of rays and the faces.
+    /// Consecutive rays are traversed together, so coherent rays should
+    /// be given in sequence. Computed in parallel if OpenMP is enabled.
+    /// \param points start points of the rays
+    /// \param dirs ray directions
+    /// \retval result the intersection point closest to the start
+    /// point for each ray, undefined if the ray misses
+    /// \retval hits whether each ray hits any face
+    void hitMany(const std::vector<Point>& points,
+		 const std::vector<Point>& dirs,
+		 std::vector<ftPoint>& result,
+		 std::vector<bool>& hits) const;
+
+    /// Classify points with respect to the closed volume bounded by
+    /// the faces. Crossings are counted along three fixed rays from
+    /// each point, and the parity is decided by majority vote, which
+    /// makes the result robust for rays touching the faces or passing
+    /// through edges. Consecutive points are traversed together, so
+    /// the points should be spatially sorted for best performance.
+    /// Computed in parallel if OpenMP is enabled.
+    /// \param points the points to classify
+    /// \retval result 1 if the point is inside, 0 if it lies on a face
+    /// within the tolerance, -1 if it is outside
+    void classify(const std::vector<Point>& points,
+		  std::vector<int>& result) const;
+
+ private:
+    struct FaceInfo
+    {
+	ftSurface* face_;
+	shared_ptr<SplineSurface> spline_;  // Only set if converted
+	shared_ptr<ParamSurface> surf_;     // Face parametrization, only
+	                                    // set if converted
+	const CurveBoundedDomain* bdomain_;
+	BezierSurfaceCache cache_;
+    };
+
+    struct Patch
+    {
+	int face_;
+	int eu_, ev_;
+	double umin_, umax_, vmin_, vmax_;
+	double low_[3], high_[3];
+    };
+
+    struct Node
+    {
+	double low_[3], high_[3];
+	int first_;  // First patch of a leaf, the right child of an inner node
+	int count_;  // Number of patches in a leaf, 0 for an inner node
+	int axis_;   // Split axis of an inner node
+    };
+
+    struct Ray;
+
+    double tol_;
+    std::vector<shared_ptr<FaceInfo> > faces_;
+    std::vector<Patch> patches_;
+    std::vector<double> grid_;  // Sample points, grid_size^2 per patch
+    std::vector<Node> nodes_;
+
+    void makePatches(const std::vector<ftSurface*>& faces);
+
+    int buildNode(int first, int last, std::vector<int>& perm,
+		  const std::vector<double>& centroids);
+
+    void traverse(Ray* rays, int nmb) const;
+
+    bool refine(int patch_idx, Ray& ray) const;
+
+    bool newton(const Patch& patch, const Ray& ray,
+		double& upar, double& vpar, double& tpar) const;
+
+    void faceParameters(const Patch& patch, double upar, double vpar,
+			double& face_u, double& face_v) const;
+
+    void makeResult(const Ray& ray, ftPoint& result) const;
+};
+
+} // namespace Go
+
+#endif // _RAYCASTER_H
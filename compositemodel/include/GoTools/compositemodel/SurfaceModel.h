@@ -65,6 +65,9 @@ namespace Go
 
   class CurveOnSurface;
   class BoundedSurface;
+  class RayCaster;
+  class GenericTriMesh;
+  class LODSurfaceMesh;
  class ftPointSet;
  class IntResultsSfModel;
  class Loop;
@@ -397,6 +400,19 @@ class GO_API SurfaceModel : public CompositeModel
   /// \return Whether the line hits or not.
   bool hit(const Point& point, const Point& dir, ftPoint& result);
 
+  /// Closest intersection between many beams and the surface model.
+  /// The faces are organized in a bounding volume hierarchy of Bezier
+  /// patches which is built at the first call, see RayCaster. 
+  /// Consecutive beams are traversed together, so coherent beams should
+  /// be given in sequence. Beams lying in a face are not reported.
+  /// \param points Start points of the beams.
+  /// \param dirs Beam directions.
+  /// \retval result Closest intersection point for each beam.
+  /// \retval hits Whether each beam hits the model.
+  void hitMany(const std::vector<Point>& points, 
+	       const std::vector<Point>& dirs,
+	       std::vector<ftPoint>& result, std::vector<bool>& hits);
+
 /*   /// The two surface models are intersected and this model is trimmed with respect to the  */
 /*   /// intersection result.  */
 /*   void booleanIntersect(shared_ptr<SurfaceModel>, // The other model */
@@ -408,6 +424,26 @@ class GO_API SurfaceModel : public CompositeModel
   */
   ftCurve intersect(const ftPlane& plane);
 
+  /** Intersect the surface model with a number of planes. The faces
+      are sorted with respect to the planes once, and the face/plane
+      intersections are computed. The curve for each plane is oriented
+      and joined as in intersect(const ftPlane&), in parallel if OpenMP
+      is enabled.
+      \param planes The planes.
+      \return One intersection curve for each plane.
+  */
+  std::vector<ftCurve> intersect(const std::vector<ftPlane>& planes);
+
+  /** Intersect the surface model with a family of parallel planes.
+      \param plane The first plane.
+      \param step Distance between consecutive planes measured along
+      the plane normal.
+      \param nmb_planes The number of planes.
+      \return One intersection curve for each plane.
+  */
+  std::vector<ftCurve> intersectPlanes(const ftPlane& plane, double step,
+				       int nmb_planes);
+
   /** Intersect the model with a plane and trim this model with respect to the
       plane, the part of the model at the positive side of the plane is removed.
       \param plane The plane.
@@ -634,6 +670,39 @@ class GO_API SurfaceModel : public CompositeModel
 		 double density,
 		 std::vector<shared_ptr<GeneralMesh> >& meshes) const;
 
+  /// Tesselate all surfaces into one watertight triangle mesh. Each
+  /// edge is discretized once, and the adjacent faces share the edge
+  /// vertices. The faces are tesselated in parallel if OpenMP is 
+  /// enabled. The boundary loops of the faces are checked and fixed
+  /// first, see ftSurface::checkAndFixBoundaries().
+  /// \param chord_tol maximum distance between the mesh and the surfaces
+  /// \param angle_tol maximum angle between surface tangents at the
+  /// end points of a mesh segment
+  /// \retval mesh indexed triangle mesh with per vertex normals
+  /// \retval tri_face index of the face corresponding to each triangle
+  /// \return false if a face could not be tesselated and is missing
+  /// from the mesh, see WatertightTesselator::tesselate()
+  bool tesselateWatertight(double chord_tol, double angle_tol,
+			   shared_ptr<GenericTriMesh>& mesh,
+			   std::vector<int>& tri_face);
+
+  /// Tesselate each surface into nested meshes for level of detail
+  /// display. The finest level satisfies the given tolerances, and
+  /// the chordal tolerance is multiplied by 4 for each coarser level.
+  /// The faces are tesselated in parallel if OpenMP is enabled. The
+  /// meshes can be stored with LODSurfaceMesh::writeCache_bin.
+  /// \param chord_tol maximum distance between the finest meshes and
+  /// the surfaces
+  /// \param angle_tol maximum angle between surface normals within
+  /// a mesh cell at the finest level
+  /// \param nmb_levels number of levels
+  /// \retval meshes one mesh for each face. If the tesselation of a
+  /// face fails, the levels completed so far are kept and the finest
+  /// of them is repeated. A face without levels gets empty levels.
+  /// \return false if the tesselation failed for any face
+  bool tesselateLOD(double chord_tol, double angle_tol, int nmb_levels,
+		    std::vector<shared_ptr<LODSurfaceMesh> >& meshes) const;
+
   /// Return a tesselation of the control polygon of all surfaces
   /// \retval ctr_pol Tesselation of the control polygon of all surfaces.
   virtual 
@@ -860,6 +929,16 @@ class GO_API SurfaceModel : public CompositeModel
   /// Inside test, uses normal direction for open shell
   bool isInside(const Point& pnt, double& dist);
 
+  /// Classify many points with respect to this surface model, which
+  /// must be closed. Uses ray parity in the hierarchy of hitMany(), 
+  /// see RayCaster::classify(). Only this shell is considered, use
+  /// Body::classifyPoints() for solids with inner shells.
+  /// \param pnts The points to classify.
+  /// \retval result 1 if the point is inside, 0 if it lies on the 
+  /// model within the gap tolerance, -1 if it is outside.
+  void classifyPoints(const std::vector<Point>& pnts, 
+		      std::vector<int>& result);
+
   /// Debug. Check topology
   bool checkShellTopology();
 
@@ -883,6 +962,7 @@ class GO_API SurfaceModel : public CompositeModel
 
   shared_ptr<CellDivision> celldiv_ ;   // To gain speedup in closest point and intersections
   mutable std::vector<bool> face_checked_;
+  shared_ptr<RayCaster> ray_caster_;  // Ray queries, built on demand
   //  mutable BoundingBox big_box_;
   BoundingBox limit_box_;
 
@@ -909,6 +989,10 @@ class GO_API SurfaceModel : public CompositeModel
 
   ftPoint closestPointLocal(const ftPoint& point) const;
 
+  // The ray queries of hitMany() and classifyPoints(), built at the
+  // first request after the faces have changed
+  RayCaster& rayCaster();
+
   void localExtreme(ftSurface *face, Point& dir, 
 		    Point& ext_pnt, int& ext_id,
 		    double ext_par[]);
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _WATERTIGHTTESSELATOR_H
+#define _WATERTIGHTTESSELATOR_H
+
+#include "GoTools/tesselator/GenericTriMesh.h"
+#include "GoTools/utils/Point.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <map>
+
+namespace Go
+{
+
+class ftSurface;
+class ftFaceBase;
+class ftEdge;
+class Vertex;
+
+/// Used internally in SurfaceModel. WatertightTesselator computes one
+/// indexed triangle mesh for a set of faces. Each edge is discretized
+/// once with respect to a chord height and an angle tolerance, and the
+/// faces meeting at the edge share the resulting vertices, so the mesh
+/// has no cracks between adjacent faces. The faces are triangulated
+/// independently, in parallel if OpenMP is enabled, by a constrained
+/// Delaunay triangulation of the edge samples in a scaled parameter
+/// domain, refined in the interior with respect to the curvature.
+class GO_API WatertightTesselator
+{
+ public:
+    /// Constructor
+    /// \param faces the faces to tesselate
+    /// \param chord_tol maximum distance between a mesh segment and 
+    /// the geometry
+    /// \param angle_tol maximum angle between the geometry tangents at 
+    /// the end points of a mesh segment
+    WatertightTesselator(const std::vector<ftSurface*>& faces,
+			 double chord_tol, double angle_tol);
+
+    /// Destructor
+    ~WatertightTesselator();
+
+    /// Compute the mesh. A face where the refined triangulation fails
+    /// is triangulated from its edge samples only. If that fails as
+    /// well, the face is left out and the mesh has a hole.
+    /// \retval mesh the triangle mesh with per vertex normals. The
+    /// boundary array marks vertices lying on edges
+    /// \retval tri_face for each triangle, the index of the face in
+    /// the input vector
+    /// \return false if any face is left out of the mesh
+    bool tesselate(shared_ptr<GenericTriMesh>& mesh,
+		   std::vector<int>& tri_face);
+
+ private:
+    // Discretization of an edge. The samples run from the start 
+    // vertex to the end vertex of the edge
+    struct EdgeSamples
+    {
+	ftEdge* edge_;
+	double max_len_;           // Maximum segment length
+	std::vector<double> par_;
+	std::vector<Point> pts_;
+	std::vector<int> idx_;     // Global vertex indices
+    };
+
+    // Triangulation of a face. Local vertices on the boundary refer to 
+    // global vertices, interior vertices are numbered afterwards
+    struct FaceMesh
+    {
+	std::vector<double> par_;  // Parameter values of local vertices
+	std::vector<int> glob_;    // Global index, -1 for interior vertices
+	std::vector<double> pos_;  // Positions of local vertices
+	std::vector<double> nrm_;  // Face normals in local vertices
+	std::vector<int> tri_;     // Local indices, three per triangle
+	bool ok_;
+    };
+
+    std::vector<ftSurface*> faces_;
+    double chord_tol_;
+    double angle_tol_;
+    std::vector<double> face_len_;       // Target triangle size in each face
+    std::map<ftFaceBase*, int> face_idx_;
+
+    std::vector<EdgeSamples> edges_;
+    std::map<ftEdge*, int> edge_idx_;    // Both an edge and its twin
+    std::map<Vertex*, int> vertex_idx_;
+    std::vector<Point> vertices_;        // Global vertices on edges
+
+    void collectEdges();
+
+    void sampleEdge(EdgeSamples& samples) const;
+
+    void refineSegment(const ftEdge* edge, double t1, const Point& p1,
+		       const Point& d1, double t2, const Point& p2,
+		       const Point& d2, double max_len, int level,
+		       std::vector<double>& par,
+		       std::vector<Point>& pts) const;
+
+    void gradeEdge(EdgeSamples& samples, double size1, double size2) const;
+
+    // Triangulate a face from the edge samples. With refine == false
+    // no interior vertices are added
+    void meshFace(int face_idx, bool refine, FaceMesh& result) const;
+
+    void boundaryPolygon(ftEdge* edge, const EdgeSamples& samples,
+			 std::vector<double>& par,
+			 std::vector<int>& glob) const;
+
+    double maxCurvature(ftSurface* face) const;
+};
+
+} // namespace Go
+
+#endif // _WATERTIGHTTESSELATOR_H
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BEZIEREXTRACTION_H
+#define _BEZIEREXTRACTION_H
+
+#include "GoTools/geometry/BsplineBasis.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+/// Bezier extraction of a B-spline basis.
+/// For each element (non-degenerate knot interval) of the basis, the
+/// order() nonzero B-splines are expressed in terms of the Bernstein
+/// polynomials on the element: N_{firstCoef(e)+i}(t) = sum_j C_e(i,j) B_j(t).
+/// The extraction operators C_e are computed once, after which the
+/// B-splines on an element may be evaluated without knot search or the
+/// Cox-de Boor recursion. Applying the operators to the coefficients of
+/// a spline gives the same Bezier coefficients as the makeBernsteinKnots
+/// functions of the spline classes, without changing the spline.
+class GO_API BezierExtraction
+{
+public:
+    /// Default constructor, making an empty extraction
+    BezierExtraction()
+	: order_(0)
+    {}
+
+    /// Constructor
+    /// \param basis the B-spline basis to extract
+    explicit BezierExtraction(const BsplineBasis& basis)
+    { setBasis(basis); }
+
+    /// Compute the extraction operators of a B-spline basis
+    /// \param basis the B-spline basis to extract
+    void setBasis(const BsplineBasis& basis);
+
+    /// The order of the basis
+    int order() const
+    { return order_; }
+
+    /// The number of elements
+    int numElem() const
+    { return (int)left_.size(); }
+
+    /// Start parameter of an element
+    double elementStart(int elem) const
+    { return breaks_[elem]; }
+
+    /// End parameter of an element
+    double elementEnd(int elem) const
+    { return breaks_[elem+1]; }
+
+    /// The index of the left knot of an element, corresponding to
+    /// BsplineBasis::lastKnotInterval()
+    int leftKnot(int elem) const
+    { return left_[elem]; }
+
+    /// The index of the first B-spline which is nonzero on an element
+    int firstCoef(int elem) const
+    { return left_[elem] - order_ + 1; }
+
+    /// The element containing a parameter value. Elements are
+    /// continuous from the right, except for the last one. Parameters
+    /// outside the domain are assigned to the first or last element.
+    int element(double par) const;
+
+    /// The extraction operator of an element, stored row-wise as an
+    /// order()*order() matrix. Row i corresponds to B-spline
+    /// firstCoef(elem)+i, column j to Bernstein polynomial j.
+    const double* extractionOperator(int elem) const
+    { return &extraction_[elem*order_*order_]; }
+
+    /// Values and derivatives of the Bernstein polynomials of an
+    /// element at a parameter value. The parameter value need not lie
+    /// inside the element. The layout is as in
+    /// BsplineBasis::computeBasisValues(), i.e. first the 0-derivs
+    /// derivatives of the first polynomial, then of the second etc.
+    /// Space for order()*(derivs+1) values must be allocated by the caller.
+    void bernsteinValues(int elem, double par, int derivs,
+			 double* result) const;
+
+    /// Values and derivatives of the nonzero B-splines of an element
+    /// at a parameter value, computed by applying the extraction
+    /// operator to the Bernstein polynomials. Layout and required
+    /// space as for bernsteinValues().
+    void basisValues(int elem, double par, int derivs, double* result) const;
+
+    /// Values and derivatives of the Bernstein polynomials of the given
+    /// order on the unit interval. Layout as for bernsteinValues().
+    static void unitBernsteinValues(int order, double upar, int derivs,
+				    double* result);
+
+private:
+    int order_;
+    std::vector<double> breaks_;     // Element boundaries, numElem()+1
+    std::vector<int> left_;          // Left knot index for each element
+    std::vector<double> extraction_; // order_*order_ per element
+};
+
+} // namespace Go
+
+#endif // _BEZIEREXTRACTION_H
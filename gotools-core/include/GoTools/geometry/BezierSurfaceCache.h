@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BEZIERSURFACECACHE_H
+#define _BEZIERSURFACECACHE_H
+
+#include "GoTools/geometry/BezierExtraction.h"
+#include "GoTools/utils/Point.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+class SplineSurface;
+
+/// Element-wise evaluation of a SplineSurface through Bezier extraction.
+/// The Bezier coefficients of every element (the same coefficients as
+/// makeBernsteinKnotsU() and makeBernsteinKnotsV() would produce) are
+/// computed once, after which evaluation on an element is a dense
+/// contraction of these coefficients with the Bernstein polynomials.
+/// The surface itself is not changed, but the cache must be recomputed
+/// by setSurface() if it is.
+/// For rational surfaces the homogeneous coefficients are stored.
+/// All evaluation functions are const and may be called concurrently.
+class GO_API BezierSurfaceCache
+{
+public:
+    /// Default constructor, making an empty cache
+    BezierSurfaceCache()
+	: dim_(0), kdim_(0), rational_(false), elemsize_(0)
+    {}
+
+    /// Constructor
+    /// \param surf the surface to extract
+    explicit BezierSurfaceCache(const SplineSurface& surf)
+    { setSurface(surf); }
+
+    /// Compute the Bezier coefficients of all elements of a surface
+    /// \param surf the surface to extract
+    void setSurface(const SplineSurface& surf);
+
+    /// The dimension of the geometry space
+    int dimension() const
+    { return dim_; }
+
+    /// Whether the surface is rational
+    bool rational() const
+    { return rational_; }
+
+    /// The Bezier extraction in a parameter direction, 0=u, 1=v
+    const BezierExtraction& extraction(int pardir) const
+    { return pardir == 0 ? ext_u_ : ext_v_; }
+
+    /// The number of elements in a parameter direction, 0=u, 1=v
+    int numElem(int pardir) const
+    { return extraction(pardir).numElem(); }
+
+    /// The element containing a parameter value in the given direction
+    int element(int pardir, double par) const
+    { return extraction(pardir).element(par); }
+
+    /// The Bezier coefficients of an element, order_u*order_v
+    /// coefficients with the u index running fastest. For rational
+    /// surfaces the coefficients are homogeneous, of size dimension()+1.
+    const double* bezierCoefs(int eu, int ev) const
+    { return &coefs_[(ev*numElem(0) + eu)*elemsize_]; }
+
+    /// Evaluate the surface at a parameter pair inside the given element
+    /// \param pt the evaluated point
+    /// \param eu element index in the u direction
+    /// \param ev element index in the v direction
+    void point(Point& pt, int eu, int ev, double upar, double vpar) const;
+
+    /// Evaluate the surface and its derivatives at a parameter pair
+    /// inside the given element. The points are ordered as in
+    /// SplineSurface::point(), i.e. S, du, dv, duu, duv, dvv, ...
+    /// \param pts the evaluated points, resized if necessary
+    /// \param derivs the number of derivatives to compute
+    void point(std::vector<Point>& pts, int eu, int ev,
+	       double upar, double vpar, int derivs) const;
+
+    /// Evaluate the surface and its derivatives in a grid of parameter
+    /// values on one element. The result contains, for each parameter
+    /// pair with the u parameter running fastest, the
+    /// (derivs+1)*(derivs+2)/2 points of the derivative triangle, each
+    /// of size dimension(), in the same order as point().
+    /// \param eu element index in the u direction
+    /// \param ev element index in the v direction
+    /// \param upars parameter values in the u direction
+    /// \param vpars parameter values in the v direction
+    /// \param derivs the number of derivatives to compute
+    /// \param result the evaluated values, resized if necessary
+    void elementGrid(int eu, int ev,
+		     const std::vector<double>& upars,
+		     const std::vector<double>& vpars, int derivs,
+		     std::vector<double>& result) const;
+
+private:
+    int dim_;
+    int kdim_;
+    bool rational_;
+    int elemsize_;
+    BezierExtraction ext_u_;
+    BezierExtraction ext_v_;
+    std::vector<double> coefs_;   // elemsize_ values per element
+
+    // Contract the coefficients of an element with precomputed
+    // Bernstein values, giving homogeneous derivatives in res.
+    void contract(const double* coefs, const double* bu, const double* bv,
+		  int derivs, double* tmp, double* res) const;
+};
+
+} // namespace Go
+
+#endif // _BEZIERSURFACECACHE_H
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BSPLINEKERNELS_H
+#define _BSPLINEKERNELS_H
+
+
+namespace Go
+{
+
+/// Evaluation kernels for B-splines of fixed, low order.
+/// The order, and for the tensor product kernels also the dimension of
+/// the (possibly homogeneous) coefficients, are template arguments, so
+/// that all loops have compile time lengths and are unrolled by the
+/// compiler. The kernels are instantiated in dispatch tables at the
+/// public evaluation functions (BsplineBasis::computeBasisValues(),
+/// SplineSurface::point() and SplineVolume::point()), which fall back
+/// to the generic code for other orders and dimensions.
+namespace BsplineKernels
+{
+    /// The range of orders and coefficient dimensions covered by the
+    /// dispatch tables.
+    const int MIN_ORDER = 2;
+    const int MAX_ORDER = 4;
+    const int MAX_DIM = 4;
+
+    /// The values of the order nonzero B-splines at tval, where
+    /// knots[left] <= tval < knots[left+1].
+    template <int order>
+    inline void basisValues(const double* knots, int left, double tval,
+			    double* result)
+    {
+	double dl[order];
+	double dr[order];
+	result[0] = 1.0;
+	for (int kj = 1; kj < order; ++kj)
+	{
+	    dl[kj] = tval - knots[left+1-kj];
+	    dr[kj] = knots[left+kj] - tval;
+	    double saved = 0.0;
+	    for (int kr = 0; kr < kj; ++kr)
+	    {
+		const double temp = result[kr]/(dr[kr+1] + dl[kj-kr]);
+		result[kr] = saved + dr[kr+1]*temp;
+		saved = dl[kj-kr]*temp;
+	    }
+	    result[kj] = saved;
+	}
+    }
+
+    /// As basisValues(), but computing also the first derivatives.
+    /// The result is stored as in BsplineBasis::computeBasisValues(),
+    /// i.e. value and derivative of the first B-spline, then of the
+    /// second etc.
+    template <int order>
+    inline void basisValuesDer1(const double* knots, int left, double tval,
+				double* result)
+    {
+	// B-splines of order-1
+	double lower[order];
+	basisValues<order-1>(knots, left, tval, lower);
+
+	// Last step of the recursion, where the same quotients give the
+	// derivatives
+	double quot[order+1];
+	quot[0] = 0.0;
+	quot[order] = 0.0;
+	double saved = 0.0;
+	for (int kr = 0; kr < order-1; ++kr)
+	{
+	    const double tl = knots[left+kr+2-order];
+	    const double tr = knots[left+kr+1];
+	    quot[kr+1] = lower[kr]/(tr - tl);
+	    result[2*kr] = saved + (tr - tval)*quot[kr+1];
+	    saved = (tval - tl)*quot[kr+1];
+	}
+	result[2*order-2] = saved;
+	for (int kr = 0; kr < order; ++kr)
+	    result[2*kr+1] = (order-1)*(quot[kr] - quot[kr+1]);
+    }
+
+    /// Tensor product of the basis values bu and bv with a uorder*vorder
+    /// block of coefficients starting at coefs, in a grid with unum
+    /// coefficients in the u direction.
+    template <int uorder, int vorder, int kdim>
+    inline void surfacePoint(const double* coefs, int unum,
+			     const double* bu, const double* bv,
+			     double* result)
+    {
+	double res[kdim];
+	for (int kd = 0; kd < kdim; ++kd)
+	    res[kd] = 0.0;
+	for (int kj = 0; kj < vorder; ++kj, coefs += unum*kdim)
+	{
+	    double tmp[kdim];
+	    for (int kd = 0; kd < kdim; ++kd)
+		tmp[kd] = 0.0;
+	    for (int ki = 0; ki < uorder; ++ki)
+		for (int kd = 0; kd < kdim; ++kd)
+		    tmp[kd] += bu[ki]*coefs[ki*kdim + kd];
+	    for (int kd = 0; kd < kdim; ++kd)
+		res[kd] += bv[kj]*tmp[kd];
+	}
+	for (int kd = 0; kd < kdim; ++kd)
+	    result[kd] = res[kd];
+    }
+
+    /// Trivariate version of surfacePoint(), vnum being the number of
+    /// coefficients in the v direction.
+    template <int uorder, int vorder, int worder, int kdim>
+    inline void volumePoint(const double* coefs, int unum, int vnum,
+			    const double* bu, const double* bv,
+			    const double* bw, double* result)
+    {
+	double res[kdim];
+	for (int kd = 0; kd < kdim; ++kd)
+	    res[kd] = 0.0;
+	for (int kk = 0; kk < worder; ++kk, coefs += unum*vnum*kdim)
+	{
+	    double tmp[kdim];
+	    surfacePoint<uorder, vorder, kdim>(coefs, unum, bu, bv, tmp);
+	    for (int kd = 0; kd < kdim; ++kd)
+		res[kd] += bw[kk]*tmp[kd];
+	}
+	for (int kd = 0; kd < kdim; ++kd)
+	    result[kd] = res[kd];
+    }
+
+    /// Function pointer types for the dispatch tables
+    typedef void (*BasisKernel)(const double*, int, double, double*);
+    typedef void (*SurfaceKernel)(const double*, int, const double*,
+				  const double*, double*);
+    typedef void (*VolumeKernel)(const double*, int, int, const double*,
+				 const double*, const double*, double*);
+
+} // namespace BsplineKernels
+
+} // namespace Go
+
+#endif // _BSPLINEKERNELS_H
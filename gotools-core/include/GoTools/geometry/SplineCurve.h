@@ -325,6 +325,39 @@ public:
     void gridEvaluator(std::vector<double>& points,
 		       const std::vector<double>& par) const;
 
+    /// Evaluate the curve and its derivatives in a number of parameter
+    /// values, which may be sorted or unsorted. Sorted parameters are
+    /// faster, as the knot interval search then starts from the
+    /// previous interval.
+    /// \param par the parameter values
+    /// \param derivs the number of derivatives to compute
+    /// \param result upon function return, for each parameter value
+    ///               the position followed by the derivatives, i.e.
+    ///               (derivs+1)*dimension() values per parameter
+    void pointsAtParams(const std::vector<double>& par, int derivs,
+			std::vector<double>& result) const;
+
+    /// Compute the closest points on the curve, restricted to the
+    /// interval [tmin, tmax], to a number of points. A hierarchy of
+    /// bounding boxes of the Bezier segments of the curve is built once
+    /// and shared by all points. It is used to select the segments
+    /// that may contain the closest point and to give start values
+    /// for the local iteration on each of them.
+    /// \param pts the points to project
+    /// \param tmin start of the parameter interval
+    /// \param tmax end of the parameter interval. The interval is
+    ///             restricted to the parameter domain of the curve, and
+    ///             an exception is thrown if they do not overlap.
+    /// \param clo_t upon function return, the parameter values of the
+    ///              closest points
+    /// \param clo_pt upon function return, the closest points
+    /// \param clo_dist upon function return, the distances
+    void closestPoints(const std::vector<Point>& pts,
+		       double tmin, double tmax,
+		       std::vector<double>& clo_t,
+		       std::vector<Point>& clo_pt,
+		       std::vector<double>& clo_dist) const;
+
     /// Get a const reference to the BsplineBasis of the curve
     /// \return const reference to the curve's BsplineBasis.
     const BsplineBasis& basis() const
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef ADAPTIVESURFACETESSELATOR_H
+#define ADAPTIVESURFACETESSELATOR_H
+
+#include "GoTools/tesselator/Tesselator.h"
+#include "GoTools/geometry/ParamSurface.h"
+#include "GoTools/tesselator/GenericTriMesh.h"
+#include "GoTools/tesselator/LODSurfaceMesh.h"
+#include "GoTools/geometry/ParamCurve.h"
+#include "GoTools/utils/Array.h"
+#include <memory>
+#include <map>
+#include "GoTools/utils/config.h"
+
+namespace Go
+{
+
+/** AdaptiveSurfaceTesselator: create a mesh for a possibly trimmed surface
+    where the triangle density follows the shape of the surface. The
+    parameter domain is subdivided by a quadtree until the chordal deviation
+    of each cell is within a given tolerance and the normals of the cell
+    deviate by less than a given angle. The quadtree is balanced so that
+    neighbouring cells differ by at most one level, and cells with hanging
+    nodes are triangulated as fans, giving a crack-free mesh. Trimmed
+    surfaces are tesselated on the underlying surface and trimmed by the
+    trimming curves afterwards.
+*/
+
+class GO_API AdaptiveSurfaceTesselator : public Tesselator
+{
+public:
+  /// Constructor. Surface, maximum chordal deviation and maximum angle
+  /// (in radians) between surface normals within one quadtree cell are given.
+    AdaptiveSurfaceTesselator(const ParamSurface& surf,
+			      double chord_tol, double angle_tol)
+	: surf_(surf), chord_tol_(chord_tol), angle_tol_(angle_tol),
+	  max_level_(10), eval_sf_(0), rectangular_(true)
+    {
+ 	mesh_ = shared_ptr<GenericTriMesh>(new GenericTriMesh(0,0,true,true));
+    }
+
+    virtual ~AdaptiveSurfaceTesselator();
+
+    virtual void tesselate();
+
+    /// Create nested meshes for level of detail. The finest level is made
+    /// with the tolerances of the tesselator, and the chordal tolerance is
+    /// multiplied by 'factor' for each coarser level. Each level refines
+    /// the quadtree of the previous one, so the vertices are shared.
+    void tesselate(LODSurfaceMesh& lod, int nmb_levels, double factor = 4.0);
+
+    /// Fetch the resulting mesh
+    shared_ptr<GenericTriMesh> getMesh()
+    {
+	return mesh_;
+    }
+
+    /// Change tolerances
+    void changeTolerances(double chord_tol, double angle_tol);
+
+    /// Fetch the tolerances
+    void getTolerances(double& chord_tol, double& angle_tol)
+    {
+	chord_tol = chord_tol_;
+	angle_tol = angle_tol_;
+    }
+
+    /// Set the maximum number of subdivisions of one root cell. Default is 10.
+    void setMaxLevel(int max_level)
+    {
+	max_level_ = max_level;
+    }
+
+private:
+    // Quadtree cell. The corner is given in integer coordinates
+    // at the resolution of the finest level.
+    struct Cell
+    {
+	int i0_, j0_;
+	int level_;
+	int child_;   // Index of the first of four children, -1 for leaves
+
+	Cell(int i0, int j0, int level)
+	    : i0_(i0), j0_(j0), level_(level), child_(-1)
+	{}
+    };
+
+    const ParamSurface& surf_;
+    shared_ptr<GenericTriMesh> mesh_;
+    double chord_tol_;
+    double angle_tol_;
+    int max_level_;
+
+    // Working data during tesselation
+    const ParamSurface* eval_sf_;
+    bool rectangular_;
+    shared_ptr<ParamSurface> under_sf_;              // Used if trimmed
+    std::vector<shared_ptr<ParamCurve> > par_cv_;    // Trimming curves
+    double umin_, umax_, vmin_, vmax_;
+    int nu_, nv_;            // Number of root cells in each direction
+    std::vector<Cell> cells_;
+    std::map<long long, int> vertex_idx_;
+    std::vector<Vector3D> vert_;
+    std::vector<Vector2D> vert_p_;
+    std::vector<Vector3D> norm_;
+
+    bool prepare();
+    void release();
+    void makeRootCells();
+    void refine(double chord_tol, double angle_tol);
+    int vertex(int i, int j);
+    void splitCell(int idx);
+    bool needsSplit(int idx, double chord_tol, double angle_tol);
+    int findCell(int i, int j, int level);
+    int neighbour(int idx, int dir);
+    bool isBalanced(int idx);
+    void balance();
+    void triangulate(std::vector<int>& mesh);
+    void appendVertices(std::vector<int>& tri, std::vector<int>& new_idx,
+			std::vector<Vector3D>& vert,
+			std::vector<Vector2D>& vert_p,
+			std::vector<int>& bd, std::vector<Vector3D>& norm);
+    void trimMesh(std::vector<Vector3D>& vert, std::vector<Vector2D>& vert_p,
+		  std::vector<int>& bd, std::vector<Vector3D>& norm,
+		  std::vector<int>& tri);
+};
+
+} // namespace Go
+
+
+
+
+#endif //  ADAPTIVESURFACETESSELATOR_H
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef LODSURFACEMESH_H
+#define LODSURFACEMESH_H
+
+#include "GoTools/tesselator/GenericTriMesh.h"
+#include "GoTools/utils/Array.h"
+#include <memory>
+#include <vector>
+#include <iostream>
+#include "GoTools/utils/config.h"
+
+namespace Go
+{
+
+/** LODSurfaceMesh: nested triangulations of one surface at decreasing
+    geometric tolerances, for progressive display. The vertices are stored
+    once. A level uses the vertices of all coarser levels plus the ones
+    added by the level itself, so level i consists of the first
+    numVertices(i) vertices and its own triangles.
+
+    The binary format is written level by level. A reader may display the
+    coarse levels before the finer ones are read, and a set of meshes (one
+    for each face of a model) can be cached such that the coarse levels of
+    all faces are stored first.
+*/
+
+class GO_API LODSurfaceMesh
+{
+public:
+    /// Constructor. Creates an empty mesh with no levels.
+    LODSurfaceMesh();
+
+    /// Destructor
+    ~LODSurfaceMesh();
+
+    /// Remove all levels
+    void clear();
+
+    /// Add a finer level. The vertex arrays contain the vertices of all
+    /// the coarser levels in the same order, followed by the new ones.
+    /// The triangles index the vertex arrays.
+    void addLevel(double tol, const std::vector<Vector3D>& vert,
+		  const std::vector<Vector2D>& vert_p,
+		  const std::vector<int>& bd,
+		  const std::vector<Vector3D>& norm,
+		  const std::vector<int>& tri);
+
+    /// Add a finer level that repeats the current finest level, with
+    /// the same vertices, triangles and tolerance. Used to give a set
+    /// of meshes the same number of levels.
+    void repeatLevel();
+
+    /// Number of levels
+    int numLevels() const
+    { return (int)levels_.size(); }
+
+    /// The geometric tolerance of a level
+    double tolerance(int level) const
+    { return levels_[level].tol_; }
+
+    /// Number of vertices used by a level, i.e. the vertices of the level
+    /// and all coarser levels
+    int numVertices(int level) const
+    { return levels_[level].nmb_vert_; }
+
+    /// Number of triangles of a level
+    int numTriangles(int level) const
+    { return (int)levels_[level].tri_.size()/3; }
+
+    /// Triangle indices of a level
+    const std::vector<int>& triangles(int level) const
+    { return levels_[level].tri_; }
+
+    /// Vertex coordinates, three entries for each vertex
+    const std::vector<double>& vertices() const
+    { return vert_; }
+
+    /// Parameter values, two entries for each vertex
+    const std::vector<double>& parameters() const
+    { return param_; }
+
+    /// Vertex normals, three entries for each vertex
+    const std::vector<float>& normals() const
+    { return norm_; }
+
+    /// Boundary flags, one entry for each vertex
+    const std::vector<unsigned char>& boundary() const
+    { return bd_; }
+
+    /// The finest level with a tolerance not larger than 'tol', or the
+    /// finest level if none are accurate enough. -1 if there are no levels.
+    int level(double tol) const;
+
+    /// Make a mesh from one level
+    shared_ptr<GenericTriMesh> mesh(int level) const;
+
+    /// Write one level (binary mode). The coarser levels must be written
+    /// first.
+    void writeLevel_bin(std::ostream& os, int level) const;
+
+    /// Read the next level (binary mode)
+    void readLevel_bin(std::istream& is);
+
+    /// Write all levels (binary mode)
+    void write_bin(std::ostream& os) const;
+
+    /// Read all levels (binary mode)
+    void read_bin(std::istream& is);
+
+    /// Write a set of meshes (binary mode). All the meshes must have the
+    /// same number of levels. The coarsest level of every mesh is written
+    /// first, then the next level, and so on.
+    static void writeCache_bin(std::ostream& os,
+			       const std::vector<shared_ptr<LODSurfaceMesh> >& meshes);
+
+    /// Read the header of a set of meshes written by writeCache_bin. Empty
+    /// meshes are created, and the number of levels is returned.
+    static int readCacheHeader_bin(std::istream& is,
+				   std::vector<shared_ptr<LODSurfaceMesh> >& meshes);
+
+    /// Read the next level of all the meshes in a set
+    static void readCacheLevel_bin(std::istream& is,
+				   std::vector<shared_ptr<LODSurfaceMesh> >& meshes);
+
+private:
+    struct Level
+    {
+	double tol_;
+	int nmb_vert_;
+	std::vector<int> tri_;
+    };
+
+    std::vector<double> vert_;
+    std::vector<double> param_;
+    std::vector<float> norm_;     // Single precision is sufficient for shading
+    std::vector<unsigned char> bd_;
+    std::vector<Level> levels_;
+};
+
+} // namespace Go
+
+
+
+
+#endif //  LODSURFACEMESH_H
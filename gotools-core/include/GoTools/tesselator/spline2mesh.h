@@ -75,6 +75,20 @@ namespace Go
 			 const int dn, const int dm,
 			 double bd_res_ratio);
 
+  // Trims a given triangulation of the containing domain of 'srf', for instance
+  // produced by an adaptive subdivision. The trimming curves are discretized with
+  // segments no longer than bd_res_ratio times ustep and vstep (if bd_res_ratio > 0).
+  void trim_mesh(shared_ptr<ParamSurface> srf,
+		 std::vector<shared_ptr<ParamCurve> >& crv_set,
+		 std::vector< Vector3D > &vert,
+		 std::vector< Vector2D > &vert_p,
+		 std::vector< int > &bd,
+		 std::vector< Vector3D > &norm,
+		 std::vector<int> &mesh,
+		 const double ustep,
+		 const double vstep,
+		 double bd_res_ratio);
+
 } // namespace Go
 
 #endif
@@ -56,6 +56,7 @@
 #include "GoTools/utils/config.h"
 #include "sislP.h"
 #include <memory>
+#include <exception>
 #include <map>
 #include <vector>
 #include <string>
@@ -268,6 +269,9 @@ public:
     IGESheader& header() { return header_; }
 
 private:
+    // The stream writer uses the entity formatting of the converter.
+    friend class IGESstreamWriter;
+
     // Data members
     bool filled_with_data_;
     std::vector<shared_ptr<Go::GeomObject> > geom_;
@@ -365,18 +369,61 @@ private:
     void writeIGESdirectory(std::string& g,
 			    const std::vector<IGESdirentry>& dirent);
     void writeIGESparsect(std::string& g, std::vector<IGESdirentry>& dirent);
+    /// Writes the start and global sections to os, and sets the
+    /// corresponding line counts in num_lines.
+    void writeIGESstartsect(std::ostream& os, int num_lines[5]);
+    /// Writes the 64-column lines in parsect as P section lines,
+    /// starting at line number first_line. The D line number of
+    /// dirent[0] is first_dir_line. The param_data_start of the
+    /// entries in dirent must be absolute line numbers.
+    void writeIGESparlines(std::ostream& os, const std::string& parsect,
+			   const std::vector<IGESdirentry>& dirent,
+			   int first_line, int first_dir_line);
+    void writeIGESterminatesect(std::ostream& os, const int num_lines[5]);
+    /// Writes the parameter data of one geometry object to g, and
+    /// adds the corresponding directory entries (possibly several
+    /// for a bounded surface). Unsupported objects are skipped.
+    void writeIGESgeom(Go::GeomObject* obj, int colour, std::string& g,
+		       std::vector<IGESdirentry>& dirent, int& Pcurr);
+    /// The number of directory entries added by writeIGESgeom(obj).
+    int numIGESdirentries(Go::GeomObject* obj);
 
     void writeIGEScolour(const std::vector<double>& colour, std::string& g,
 			 std::vector<IGESdirentry>& dirent, int& Pcurr);
 
     IGESdirentry readIGESdirentry(const char* start);
+
+    /// Result of decoding the parameter data of an entity which does
+    /// not refer to other entities. Filled independently for each
+    /// entity (possibly in parallel), and added to the local storage
+    /// afterwards in directory order.
+    struct DecodedEntity
+    {
+	shared_ptr<Go::GeomObject> geom;
+	Go::Point plane_normal;  // Only used for entities 110 and 126
+	std::exception_ptr error;
+    };
+    /// True if the parameter data of the entity can be decoded without
+    /// access to any other entity than transformation matrices.
+    static bool isIndependentEntity(const IGESdirentry& dirent);
+    /// Decode the parameter data of entity number dir_idx. Does not
+    /// modify the state of the converter, any exception is stored in
+    /// the result.
+    void decodeIndependentEntity(int dir_idx, const char* posP0,
+				 DecodedEntity& result);
+    /// Add a decoded entity to the local storage, rethrowing any
+    /// exception caught during decoding.
+    void addDecodedEntity(int dir_idx, const DecodedEntity& decoded);
     shared_ptr<Go::SplineSurface>
       readIGESsurface(const char* start, int num_lines);
     void writeIGESsurface(Go::SplineSurface* surf, int colour, std::string& g,
                           std::vector<IGESdirentry>& dirent, int& Pcurr,
 			  int dependency = 0);
+    // The normal is returned in plane_normal if the curve is flagged
+    // as planar, otherwise plane_normal is empty.
     shared_ptr<Go::SplineCurve>
-      readIGEScurve(const char* start, int num_lines, int direntry_index);
+      readIGEScurve(const char* start, int num_lines, int direntry_index,
+		    Go::Point& plane_normal);
 //     shared_ptr<Go::SplineCurve>
     shared_ptr<Go::BoundedCurve>
       readIGESline(const char* start, int num_lines, int direntry_index);
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _IGESSTREAMWRITER_H
+#define _IGESSTREAMWRITER_H
+
+#include "GoTools/igeslib/IGESconverter.h"
+#include <cstdio>
+#include <vector>
+#include <string>
+#include <iostream>
+
+
+namespace Go
+{
+
+/// Incremental writing of an IGES file.
+/// Geometry objects are formatted and written as they are added, so the
+/// complete model never needs to be kept in memory. The directory and
+/// parameter sections are buffered in temporary files while objects are
+/// added, and the file is assembled when finish() is called. Supported
+/// objects are the same as for IGESconverter::writeIGES(): spline curves,
+/// spline surfaces and bounded surfaces.
+class GO_API IGESstreamWriter
+{
+public:
+    /// Constructor. The IGES file is written to os when finish() is called.
+    IGESstreamWriter(std::ostream& os);
+
+    /// Destructor. Removes the temporary files. Does not call finish().
+    ~IGESstreamWriter();
+
+    /// Header info. May be modified until finish() is called.
+    IGESheader& header()
+    { return conv_.header(); }
+
+    /// Format and write one geometry object.
+    /// \param obj the object
+    /// \param colour RGB-triplet with values in the range 0.0 to 100.0,
+    ///        or empty if no colour is specified
+    void addGeom(shared_ptr<GeomObject> obj,
+		 const std::vector<double>& colour = std::vector<double>());
+
+    /// Format and write a number of geometry objects. The parameter
+    /// records of the objects are formatted in parallel if OPENMP is
+    /// included. The objects are written in the given order.
+    /// \param objs the objects
+    /// \param colours colour of each object, see above. May be empty.
+    void addGeom(const std::vector<shared_ptr<GeomObject> >& objs,
+		 const std::vector<std::vector<double> >& colours
+		 = std::vector<std::vector<double> >());
+
+    /// Write the complete file to the output stream. No objects can be
+    /// added afterwards.
+    void finish();
+
+    /// Number of directory entries written so far
+    int numEntities() const
+    { return nmb_dir_; }
+
+private:
+    /// The formatted parameter data of one or more consecutive entities
+    struct Chunk
+    {
+	std::string pdata;
+	std::vector<IGESdirentry> dirent;
+    };
+
+    IGESconverter conv_;   // Entity formatting and header
+    std::ostream& os_;
+    std::FILE* dfile_;     // Directory section lines
+    std::FILE* pfile_;     // Parameter section lines
+    int nmb_dir_;          // Number of directory entries written
+    int nmb_plines_;       // Number of P lines written
+    bool finished_;
+    std::vector<std::vector<double> > colours_;
+    std::vector<int> colour_dir_;  // D line number of colour entities
+
+    /// D line pointer to the colour entity, written if it does not exist
+    int colourPointer(const std::vector<double>& colour);
+    /// Relocate the chunk to the current end of the file and write it
+    void writeChunk(Chunk& chunk);
+    /// Copy the content of the temporary file to the output stream
+    void copyFile(std::FILE* file);
+};
+
+} // namespace Go
+
+#endif // _IGESSTREAMWRITER_H
@@ -54,6 +54,8 @@ namespace Go {
 
 class SplineCurve;
 class SplineSurface;
+class BernsteinTetrahedralPoly;
+class Binomial;
 
 
 /// Takes a segment (defined as having numCoefs() == order() and an
@@ -84,6 +86,69 @@ void spline_to_bernstein(const SplineSurface& pat,
 			 std::vector<BernsteinMulti>& pat_bm);
 
 
+/// Scales the coefficients of a tensor product Bernstein polynomial of
+/// degree (du, dv) with the binomial coefficients
+/// \f${du \choose i}{dv \choose j}\f$. In this scaled form, products
+/// of polynomials are plain convolutions of the coefficients, see
+/// bernstein_scaled_product_add(). A univariate polynomial is given by
+/// dv = 0.
+/// \param du degree in the first parameter direction
+/// \param dv degree in the second parameter direction
+/// \param coefs the (du+1)*(dv+1) coefficients, scaled on output
+/// \param binom table of binomial coefficients, expanded if
+/// necessary. Callers scaling many polynomials should reuse one table.
+void bernstein_scale(int du, int dv, double* coefs, Binomial& binom);
+
+/// Inverse of bernstein_scale().
+/// \param du degree in the first parameter direction
+/// \param dv degree in the second parameter direction
+/// \param coefs the (du+1)*(dv+1) scaled coefficients, unscaled on
+/// output
+/// \param binom table of binomial coefficients, expanded if necessary
+void bernstein_unscale(int du, int dv, double* coefs, Binomial& binom);
+
+/// Adds the product of two tensor product Bernstein polynomials to a
+/// third, all given on the scaled form of bernstein_scale(). The
+/// result has degree (pu+qu, pv+qv). No memory is allocated, and the
+/// innermost loop runs over contiguous coefficients.
+/// \param p coefficients of the first factor, degree (pu, pv)
+/// \param q coefficients of the second factor, degree (qu, qv)
+/// \param res coefficients of the result, to which the product is added
+void bernstein_scaled_product_add(const double* p, int pu, int pv,
+				  const double* q, int qu, int qv,
+				  double* res);
+
+/// Computes all tetrahedral Bernstein basis polynomials of degree deg
+/// composed with the four barycentric coordinate functions of a patch.
+/// These are the columns of the matrix D used in implicitization. The
+/// coordinate functions must have equal degrees (du, dv), and the
+/// result is a sequence of (deg+1)*(deg+2)*(deg+3)/6 tensor product
+/// Bernstein polynomials of degree (deg*du, deg*dv), stored one after
+/// the other. A curve is given by dv = 0.
+/// \param beta coefficients of the four coordinate functions, stored
+/// one after the other
+/// \param du degree of the coordinate functions in the first direction
+/// \param dv degree of the coordinate functions in the second direction
+/// \param deg degree of the tetrahedral basis
+/// \param basis the resulting polynomials
+void tetrahedral_basis_composition(const std::vector<double>& beta,
+				   int du, int dv, int deg,
+				   std::vector<double>& basis);
+
+/// Composes a tetrahedral Bernstein polynomial with the four barycentric
+/// coordinate functions of a surface patch. Gives the same result as
+/// impl(beta) with the BernsteinMulti version of
+/// BernsteinTetrahedralPoly::operator(), but runs the de Casteljau
+/// algorithm on scaled coefficients in two preallocated buffers instead
+/// of creating temporary polynomials.
+/// \param impl the tetrahedral polynomial
+/// \param beta the coordinate functions, which must have equal degrees
+/// \param result the composed polynomial
+void compose_tetrahedral(const BernsteinTetrahedralPoly& impl,
+			 const Array<BernsteinMulti, 4>& beta,
+			 BernsteinMulti& result);
+
+
 /// Converts a Bezier curve segment on SplineCurve form to an Array of
 /// \a Ndim BernsteinPolys. If the SplineCurve is rational, \a Ndim is
 /// equal to \a dim+1, where \a dim is the dimension of
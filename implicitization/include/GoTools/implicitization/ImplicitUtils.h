@@ -117,6 +117,32 @@ void make_matrix(const PointCloud4D& cloud, int deg,
 void make_implicit_svd(std::vector<std::vector<double> >& mat, 
 		       std::vector<double>& b, double& sigma_min);
 
+/// Add the rows of the matrix D to the upper triangular factor R of the
+/// Gram matrix, such that R^T R = D^T D for the matrix D of all rows
+/// added so far. The factor is updated by Givens rotations, which
+/// avoids forming D^T D and squaring its condition number. Matrices
+/// from several patches may thereby be added one at a time. R is
+/// stored row by row in a vector of size n*n, where n is the number of
+/// columns in D, and should be empty before the first rows are added.
+void add_to_gram_factor(const std::vector<std::vector<double> >& mat,
+			std::vector<double>& gram_factor);
+
+/// Make the factor R of the Gram matrix of the matrix D of a point
+/// cloud, see add_to_gram_factor(). The rows of D are added as they
+/// are made, so D is never stored.
+void make_gram_factor(const PointCloud4D& cloud, int deg,
+		      std::vector<double>& gram_factor);
+
+/// Performs implicitization using inverse iteration with the Gram
+/// matrix R^T R = D^T D, given the factor R made by
+/// add_to_gram_factor() or make_gram_factor(). The result is the
+/// right singular vector of D for the smallest singular value, as in
+/// make_implicit_svd(), at a cost of O(n^2) per iteration once the
+/// factor is made. If the iteration does not converge, the SVD of R
+/// is used instead.
+void make_implicit_gram(const std::vector<double>& gram_factor,
+			std::vector<double>& b, double& sigma_min);
+
 /// Performs implicitization using Gaussian elimination. This method
 /// is suitable when the implicitization is exact. If the
 /// implicitization is approximate, make_implicit_svd() is better.
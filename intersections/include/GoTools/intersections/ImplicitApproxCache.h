@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _IMPLICITAPPROXCACHE_H
+#define _IMPLICITAPPROXCACHE_H
+
+
+#include "GoTools/utils/config.h"
+#include <memory>
+#include <map>
+#include <list>
+#include <cstddef>
+
+
+namespace Go {
+
+
+class ParamSurface;
+class SplineSurface;
+class AlgObj3DInt;
+
+
+/// Cache of approximate implicit representations of spline surface
+/// pieces, shared by all intersectors. When the same surface is
+/// intersected against many others, the implicitization of its
+/// subdivided pieces can then be reused instead of being computed
+/// anew in each intersection.
+///
+/// An entry is keyed by the surface given to the top level
+/// intersection object and the parameter domain of the piece. The
+/// surface must be the same object in all intersections for its
+/// entries to be reused, so callers should pass the surface itself
+/// rather than a copy. The coefficients of the piece are
+/// checked as well, so an entry is not used if the surface has been
+/// modified after the entry was stored. Entries of surfaces that have
+/// been deleted are never used and are evicted first.
+///
+/// The cache is empty and inactive until a memory limit is given with
+/// setMemoryLimit(). When the limit is exceeded, the least recently
+/// used entries are evicted.
+
+class ImplicitApproxCache {
+public:
+    /// The cache used by the intersection objects.
+    static ImplicitApproxCache* globalCache();
+
+    /// Set the maximum memory used by the cached implicit objects. A
+    /// limit of zero turns the cache off. Entries are evicted if the
+    /// current content exceeds the new limit.
+    /// \param bytes the memory limit in bytes
+    void setMemoryLimit(size_t bytes);
+
+    /// The maximum memory used by the cached implicit objects.
+    size_t memoryLimit() const
+    { return mem_limit_; }
+
+    /// Estimated memory used by the cached implicit objects.
+    size_t memoryUsage() const
+    { return mem_usage_; }
+
+    /// Number of cached entries.
+    int size() const
+    { return (int)entries_.size(); }
+
+    /// Check if the cache is active, i.e. has a nonzero memory limit.
+    bool active() const
+    { return mem_limit_ > 0; }
+
+    /// Number of successful and failed lookups since the cache was
+    /// last cleared.
+    void statistics(int& hits, int& misses) const
+    { hits = nmb_hits_; misses = nmb_misses_; }
+
+    /// Remove all entries.
+    void clear();
+
+    /// Remove all entries belonging to a given surface.
+    /// \param surf the surface given to the top level intersection
+    /// object.
+    void remove(const ParamSurface* surf);
+
+    /// Look up the implicit representation of a surface piece.
+    /// \param surf the surface given to the top level intersection
+    /// object.
+    /// \param piece the spline surface piece that is implicitized.
+    /// \retval implicit the implicit representation, if found.
+    /// \retval err the implicitization error, if found.
+    /// \return 'true' if an entry was found.
+    bool fetch(shared_ptr<const ParamSurface> surf, const SplineSurface& piece,
+	       shared_ptr<AlgObj3DInt>& implicit, double& err);
+
+    /// Store the implicit representation of a surface piece. Nothing
+    /// is stored if the cache is inactive.
+    /// \param surf the surface given to the top level intersection
+    /// object.
+    /// \param piece the spline surface piece that is implicitized.
+    /// \param implicit the implicit representation.
+    /// \param err the implicitization error.
+    void store(shared_ptr<const ParamSurface> surf, const SplineSurface& piece,
+	       shared_ptr<AlgObj3DInt> implicit, double err);
+
+private:
+    ImplicitApproxCache();
+
+    struct Key
+    {
+	const ParamSurface* surf;
+	double domain[4];
+	bool operator<(const Key& other) const;
+    };
+
+    struct Entry
+    {
+	std::weak_ptr<const ParamSurface> surf;
+	size_t checksum;
+	shared_ptr<AlgObj3DInt> implicit;
+	double err;
+	size_t bytes;
+	std::list<Key>::iterator lru_pos;
+    };
+
+    typedef std::map<Key, Entry> EntryMap;
+
+    EntryMap entries_;
+    std::list<Key> lru_;   // Most recently used first
+    size_t mem_limit_;
+    size_t mem_usage_;
+    int nmb_hits_;
+    int nmb_misses_;
+
+    Key makeKey(const ParamSurface* surf, const SplineSurface& piece) const;
+    void erase(EntryMap::iterator it);
+    void evict();
+};
+
+
+} // namespace Go
+
+
+#endif // _IMPLICITAPPROXCACHE_H
+
@@ -109,8 +109,9 @@ public:
     ~IntersectionPoint();
 
     /// Default constructor
-    IntersectionPoint() {} // create an undefined point which can be
-			   // assigned or read() into.
+    IntersectionPoint() : param_revision_(0) {} // create an undefined
+						// point which can be
+						// assigned or read() into.
     
     /// Write IntersectionPoint to stream (NB: topological and parent
     /// information will be lost)
@@ -141,6 +142,14 @@ public:
     /// course have length equal to the total number of parameters
     /// defining this IntersectionPoint.
     void replaceParameter(double *param);
+
+    /// Counter that is incremented each time this IntersectionPoint
+    /// changes its parameters through replaceParameter(). Used by
+    /// search structures keyed on parameter values to detect that
+    /// the key of this point is out of date.
+    /// \return the current revision
+    unsigned int parameterRevision() const
+    { return param_revision_; }
     
     /// Get average of the IntersectionPoint's position in space as
     /// evaluated in the two underlying objects.
@@ -759,6 +768,9 @@ private:
     // Parameter values of this intersection point
     std::vector<double> par_;
 
+    // Incremented by replaceParameter(), see parameterRevision()
+    unsigned int param_revision_;
+
     // If obj1_ or obj2_ has parents, then parent_point_ is the
     // corresponding intersection point
     shared_ptr<IntersectionPoint> parent_point_;
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _INTERSECTIONPOINTINDEX_H
+#define _INTERSECTIONPOINTINDEX_H
+
+
+#include "GoTools/intersections/IntersectionPoint.h"
+#include <memory>
+#include <vector>
+#include <map>
+
+
+namespace Go {
+
+
+/// Search structure over the IntersectionPoints of an
+/// IntersectionPool. Membership is answered through a map keyed by
+/// the point address, and parameter queries through one sorted
+/// sequence per parameter direction, so that both run in
+/// logarithmic time in the number of points. The structure is
+/// updated incrementally as points are inserted and removed. The
+/// parameter keys are recorded on insertion together with the
+/// parameter revision of each point (see
+/// IntersectionPoint::parameterRevision()). Points may change their
+/// parameters after that, so updateKeys() must be called before
+/// parameter queries are made. Membership queries are not affected.
+
+class IntersectionPointIndex {
+public:
+    /// Constructor. Makes an empty index.
+    IntersectionPointIndex();
+
+    /// Remove all points from the index.
+    void clear();
+
+    /// Replace the content of the index by the given points.
+    /// \param pts the points to index
+    void build(const std::vector<shared_ptr<IntersectionPoint> >& pts);
+
+    /// Add one point to the index. A point inserted several times
+    /// is counted with multiplicity.
+    /// \param pt the point to add
+    void insert(const shared_ptr<IntersectionPoint>& pt);
+
+    /// Remove one occurrence of a point from the index. Nothing
+    /// happens if the point is not indexed.
+    /// \param pt the point to remove
+    void remove(const IntersectionPoint* pt);
+
+    /// Number of indexed points, counted with multiplicity.
+    int size() const
+    { return nmb_points_; }
+
+    /// Record the current parameters as parameter keys for the
+    /// indexed points whose parameter revision differs from the one
+    /// recorded with their keys. The check is linear in the number
+    /// of points, but only changed points are re-keyed.
+    void updateKeys();
+
+    /// Check if a point is indexed.
+    /// \param pt the point to look for
+    /// \return 'true' if \a pt is in the index
+    bool contains(const IntersectionPoint* pt) const
+    { return points_.find(pt) != points_.end(); }
+
+    /// Fetch the shared pointer of an indexed point.
+    /// \param pt the point to look for
+    /// \return the shared pointer to \a pt, or an empty pointer if
+    /// \a pt is not in the index
+    shared_ptr<IntersectionPoint> find(const IntersectionPoint* pt) const;
+
+    /// Check if any indexed point has a parameter value in the given
+    /// direction that equals \a par within the relative parameter
+    /// resolution of that point.
+    /// \param dir the parameter direction
+    /// \param par the parameter value
+    /// \return 'true' if such a point exists
+    bool existPoint(int dir, double par) const;
+
+    /// Check if any indexed point coincides with the given parameter
+    /// values, i.e. differs by less than \a tol in all parameter
+    /// directions.
+    /// \param par pointer to the parameter values. The number of
+    /// values is the number of parameters of the indexed points.
+    /// \param tol the tolerance
+    /// \return 'true' if such a point exists
+    bool existIdentical(const double* par, double tol) const;
+
+private:
+    struct Entry
+    {
+	shared_ptr<IntersectionPoint> point;
+	std::vector<double> key;
+	unsigned int revision;
+	int count;
+    };
+    typedef std::map<const IntersectionPoint*, Entry> PointMap;
+    typedef std::multimap<double, const IntersectionPoint*> ParamMap;
+
+    PointMap points_;
+    std::vector<ParamMap> param_;
+    double max_tol_;
+    int nmb_points_;
+
+    void insertKeys(const IntersectionPoint* pt, Entry& entry);
+    void removeKeys(const IntersectionPoint* pt, const Entry& entry);
+};
+
+
+} // namespace Go
+
+
+#endif // _INTERSECTIONPOINTINDEX_H
+
@@ -44,6 +44,7 @@
 #include "GoTools/intersections/ParamObjectInt.h"
 #include "GoTools/intersections/IntersectionPoint.h"
 #include "GoTools/intersections/IntersectionCurve.h"
+#include "GoTools/intersections/IntersectionPointIndex.h"
 #include "GoTools/utils/Point.h"
 #include <memory>
 #include <vector>
@@ -412,13 +413,6 @@ public:
     void getIntersectionCurves(std::vector<shared_ptr<IntersectionCurve> >&
 			       int_curves) const;
     
-    /// Get a reference to the vector containing (shared pointers to)
-    /// 'this' IntersectionPool's IntersectionPoints.
-    /// \retval reference to vector of shared pointers to
-    /// IntersectionPoints
-    std::vector<shared_ptr<IntersectionPoint> >&
-    getIntersectionPoints();
-
     /// Get a reference to the vector containing (shared pointers to)
     /// 'this' IntersectionPools IntersectionPoint s.
     /// \retval reference to vector of shared pointers to
@@ -801,6 +795,16 @@ private:
     // Intersection points (both isolated and on curves)
     std::vector<shared_ptr<IntersectionPoint> > int_points_;
 
+    // Incremented each time int_points_ is changed. All changes go
+    // through append_point() and erase_point().
+    unsigned int points_revision_;
+
+    // Search structure over int_points_, kept up to date by
+    // append_point() and erase_point(). Rebuilt on demand by
+    // point_index() if its revision differs from points_revision_.
+    mutable IntersectionPointIndex point_index_;
+    mutable unsigned int point_index_revision_;
+
     // Intersection curves
     std::vector<shared_ptr<IntersectionCurve> > int_curves_;
 
@@ -813,6 +817,14 @@ private:
 
     // Functions
 
+    void append_point(shared_ptr<IntersectionPoint> point);
+
+    void erase_point(std::vector<shared_ptr<IntersectionPoint> >::iterator it);
+
+    const IntersectionPointIndex& point_index(bool with_keys = false) const;
+
+    const IntersectionPool* orig_pool() const;
+
     void 
     add_point_and_propagate_upwards(shared_ptr<IntersectionPoint> point);
 
@@ -830,11 +842,11 @@ private:
 				    int missing_dir,
 				    double missing_value);
 
-    void associate_parent_points(std::vector<shared_ptr<IntersectionPoint> >& children,
+    void associate_parent_points(const std::vector<shared_ptr<IntersectionPoint> >& children,
 				 int lacking_ix,
 				 double lacking_val);
 
-    void transfer_links_to_parent_points(std::vector<shared_ptr<IntersectionPoint> >&
+    void transfer_links_to_parent_points(const std::vector<shared_ptr<IntersectionPoint> >&
 					 children, int lacking_ix);
 
     void get_param_limits(int pardir,
@@ -895,15 +907,6 @@ getIntersectionCurves(std::vector<shared_ptr<IntersectionCurve> >& int_curves) c
 }
 
 
-//===========================================================================
-inline std::vector<shared_ptr<IntersectionPoint> >&
-IntersectionPool::getIntersectionPoints()
-//===========================================================================
-{
-    return int_points_;
-}
-
-
 //===========================================================================
 inline const std::vector<shared_ptr<IntersectionPoint> >& 
 IntersectionPool::getIntersectionPoints() const
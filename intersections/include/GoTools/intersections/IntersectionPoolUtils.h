@@ -59,6 +59,8 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <map>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -419,6 +421,50 @@ private:
 };
 
 
+//===========================================================================
+// Build the connectivity table of the given points, as defined by the
+// links between them. The result equals the table generated from a
+// ConnectionFunctor, but it is found from the neighbours of each
+// point rather than by testing all pairs of points.
+void build_link_table(const std::vector<
+		      shared_ptr<IntersectionPoint> >& ipoints,
+		      std::vector<std::vector<int> >& table)
+//===========================================================================
+{
+    typedef std::multimap<const IntersectionPoint*, int> PositionMap;
+    int num_points = (int)ipoints.size();
+    PositionMap position;
+    for (int i = 0; i < num_points; ++i)
+	position.insert(PositionMap::value_type(ipoints[i].get(), i));
+
+    table.clear();
+    table.resize(num_points);
+    std::vector<IntersectionPoint*> neighbours;
+    for (int i = 0; i < num_points; ++i) {
+	ipoints[i]->getNeighbours(neighbours);
+	if (neighbours.size() > 0) {
+	    // IntersectionPoint::isConnectedTo() regards a point with
+	    // links as connected to itself, thus several occurrences of
+	    // the same point are connected
+	    neighbours.push_back(ipoints[i].get());
+	}
+	for (size_t n = 0; n < neighbours.size(); ++n) {
+	    std::pair<PositionMap::const_iterator, PositionMap::const_iterator>
+		range = position.equal_range(neighbours[n]);
+	    for (PositionMap::const_iterator it = range.first;
+		 it != range.second; ++it) {
+		if (it->second != i)
+		    table[i].push_back(it->second);
+	    }
+	}
+	std::sort(table[i].begin(), table[i].end());
+	table[i].erase(std::unique(table[i].begin(), table[i].end()),
+		       table[i].end());
+    }
+}
+
+
+
 //===========================================================================
 
 
@@ -544,8 +590,9 @@ void extract_chains(const std::vector<
     // find out which IntersectionPoints are connected
     std::vector<std::vector<int> > paths, cycles;
     std::vector<int> singles;
-    get_individual_paths((int)pts.size(), ConnectionFunctor(pts),
-			 paths, cycles, singles);
+    std::vector<std::vector<int> > table;
+    build_link_table(pts, table);
+    get_individual_paths((int)pts.size(), table, paths, cycles, singles);
 
     // generating chains of 0 length  (single points)
     for (int i = 0; i < int(singles.size()); ++i) {
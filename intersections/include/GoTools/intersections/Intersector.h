@@ -68,7 +68,9 @@ class Intersector {
 public:
 
     /// Default constructor
-    Intersector() : prev_intersector_(0) {}
+    Intersector() : prev_intersector_(0),
+	max_seconds_(0.0), max_subdivisions_(0), nmb_subdivisions_(0),
+	limit_reached_(false), start_time_(0.0) {}
 
     /// Constructor.
     /// \param epsge the geometric tolerance for the intersector.
@@ -189,6 +191,42 @@ public:
 	    return prev_intersector_->nmbRecursions() + 1;
     }
 
+    /// Limit the effort spent by the intersector. When a limit is
+    /// reached no further subdivision is performed, the remaining
+    /// subproblems are left unresolved and the intersection results
+    /// found so far are returned by getResult(). The limits are
+    /// checked cooperatively and apply to the top level intersector
+    /// and all its sub intersectors.
+    /// \param max_seconds maximum wall clock time for compute(),
+    /// measured from the start of the top level computation. 0 means
+    /// no limit.
+    /// \param max_subdivisions maximum number of subdivision steps.
+    /// 0 means no limit.
+    void setLimits(double max_seconds, int max_subdivisions)
+    {
+	max_seconds_ = (max_seconds < 0.0) ? 0.0 : max_seconds;
+	max_subdivisions_ = (max_subdivisions < 0) ? 0 : max_subdivisions;
+    }
+
+    /// Check if the computation was stopped by the limits given in
+    /// setLimits().
+    /// \return True if a limit was reached and the result may be
+    /// incomplete.
+    bool limitReached() const
+    {
+	return (prev_intersector_ == 0) ? limit_reached_ 
+	    : prev_intersector_->limitReached();
+    }
+
+    /// The number of subdivision steps performed so far by the top
+    /// level intersector and its sub intersectors.
+    /// \return The number of subdivision steps.
+    int nmbSubdivisions() const
+    {
+	return (prev_intersector_ == 0) ? nmb_subdivisions_
+	    : prev_intersector_->nmbSubdivisions();
+    }
+
     /// Verify whether the surface is self-intersecting.
     /// \return True if the surface is self-intersecting.
     virtual bool isSelfIntersection()
@@ -221,6 +259,13 @@ protected:
     shared_ptr<SingularityInfo> singularity_info_;
     shared_ptr<ComplexityInfo> complexity_info_;
 
+    // Effort limits, only used in the top level intersector
+    double max_seconds_;
+    int max_subdivisions_;
+    int nmb_subdivisions_;
+    bool limit_reached_;
+    double start_time_;
+
     //     virtual shared_ptr<Intersector> 
     //       lowerOrderIntersector(shared_ptr<ParamObjectInt> obj1,
     // 			    shared_ptr<ParamObjectInt> obj2, 
@@ -276,6 +321,12 @@ protected:
 	}
 
     virtual void printDebugInfo() = 0;
+
+    /// Check the limits given in setLimits() before a subdivision
+    /// step and count the step if it may be performed.
+    /// \return True if the subdivision should be skipped.
+    bool subdivisionLimitReached();
+
 private:
 
 };
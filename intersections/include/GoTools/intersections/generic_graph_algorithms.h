@@ -99,6 +99,18 @@ void get_individual_paths(int num_nodes,
 			  std::vector<int>& isolated_nodes);
 //===========================================================================
 
+//===========================================================================
+//As above, but with connectivity information expressed by the
+//'table' sequence.  Entry 'i' in this table is a list of indices of
+//the nodes connected to node 'i', in increasing order.  The table is
+//modified by the function.
+void get_individual_paths(int num_nodes,
+			  std::vector<std::vector<int> >& table,
+			  std::vector<std::vector<int> >& paths,
+			  std::vector<std::vector<int> >& cycles,
+			  std::vector<int>& isolated_nodes);
+//===========================================================================
+
 
 
 			       
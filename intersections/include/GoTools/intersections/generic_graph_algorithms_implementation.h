@@ -192,6 +192,20 @@ void get_individual_paths(int num_nodes,
     isolated_nodes.clear();
     std::vector<std::vector<int> > table;
     build_connectivity_table(num_nodes, connectedTo, table);
+    get_individual_paths(num_nodes, table, paths, cycles, isolated_nodes);
+}
+
+//===========================================================================
+void get_individual_paths(int num_nodes,
+			  std::vector<std::vector<int> >& table,
+			  std::vector<std::vector<int> >& paths,
+			  std::vector<std::vector<int> >& cycles,
+			  std::vector<int>& isolated_nodes)
+//===========================================================================
+{
+    paths.clear();
+    cycles.clear();
+    isolated_nodes.clear();
     
 //     // debug: print connectivity table
 //     std::ofstream os("ConnectivityTable.data");
@@ -164,6 +164,11 @@ namespace Go
     // Release scratch related to pre evaluated basis functions and surface.
     virtual void erasePreEvaluatedBasisFunctions();
 
+    // Fetch the grid evaluation of the geometry surface in the given Gauss
+    // points. The grid is reused if it is already evaluated in the same points
+    shared_ptr<const preEvaluationGeomSf> getGeometryGrid(const std::vector<double>& par_u,
+							  const std::vector<double>& par_v);
+
     // 1. derivative in u-direction, 1. derivatuve in v_direction
 
     // Fetch boundary conditions
@@ -226,6 +231,10 @@ namespace Go
     // The surface describing the geometry
     shared_ptr<SplineSurface> surface_;
 
+    // Geometry surface evaluated in the Gauss points of the latest pre
+    // evaluation, shared between the solution spaces
+    shared_ptr<preEvaluationGeomSf> geometry_grid_;
+
     // The position index in the Model object
     int index_;
 
@@ -49,6 +49,7 @@
 #include "GoTools/trivariate/SplineVolume.h"
 #include "GoTools/isogeometric_model/IsogeometricBlock.h"
 #include "GoTools/isogeometric_model/VolSolution.h"
+#include "GoTools/isogeometric_model/VolGeometryGrid.h"
 #include "GoTools/isogeometric_model/VolBoundaryCondition.h"
 #include "GoTools/isogeometric_model/VolPointBdCond.h"
 
@@ -168,6 +169,39 @@ namespace Go
     // Release scratch related to pre evaluated basis functions and surface.
     virtual void erasePreEvaluatedBasisFunctions();
 
+    // Compute Gauss points and weights for integration over the block.
+    // Gauss-Legendre points are placed in each knot interval of the union
+    // of the spline spaces of the solutions, with the number of points given
+    // by the highest order of the solution spaces.
+    void getGaussParameters(std::vector<std::vector<double> >& Gauss_par,
+			    std::vector<std::vector<double> >& Gauss_wgt) const;
+
+    // Pre evaluate the basis functions of all solution spaces in the given
+    // Gauss points. The geometry volume is evaluated once and shared between
+    // the solution spaces.
+    void performPreEvaluation(std::vector<std::vector<double> >& Gauss_par,
+			      std::vector<std::vector<double> >& Gauss_wgt);
+
+    // Pre evaluate all solution spaces in the Gauss points given by
+    // getGaussParameters()
+    void performPreEvaluation();
+
+    // Fetch the grid evaluation of the geometry volume in the given Gauss
+    // points. The grid is reused if it is already evaluated in the same points
+    shared_ptr<VolGeometryGrid> getGeometryGrid(const std::vector<double>& par_u,
+						const std::vector<double>& par_v,
+						const std::vector<double>& par_w);
+
+    // Limit the memory used for the pre evaluated geometry. If max_chunks
+    // is positive, the geometry is evaluated on demand for one element of
+    // the geometry volume at the time, and at most max_chunks elements are
+    // kept. 0 means that the geometry is evaluated in all Gauss points at once.
+    // Applies to subsequent pre evaluations.
+    void setGeometryCacheSize(int max_chunks);
+
+    // The maximum number of cached elements of pre evaluated geometry
+    int geometryCacheSize() const;
+
     // Fetch boundary conditions
     // Get the number of boundary conditions attached to this block
     virtual int getNmbOfBoundaryConditions() const;
@@ -236,6 +270,13 @@ namespace Go
     // The volume describing the geometry
     shared_ptr<SplineVolume> volume_;
 
+    // Geometry volume evaluated in the Gauss points of the latest pre
+    // evaluation, shared between the solution spaces
+    shared_ptr<VolGeometryGrid> geometry_grid_;
+
+    // Maximum number of cached elements in geometry_grid_, 0 means no limit
+    int geometry_cache_size_;
+
     // The position index in the Model object
     int index_;
 
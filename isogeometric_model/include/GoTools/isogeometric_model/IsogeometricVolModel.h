@@ -129,6 +129,20 @@ namespace Go
     // Fetch all the single block defining this multi-block model
     void getIsogeometricBlocks(std::vector<shared_ptr<IsogeometricVolBlock> >& volblock);
 
+    // Pre evaluate the basis functions of all solution spaces in all blocks
+    // in the Gauss points given by IsogeometricVolBlock::getGaussParameters().
+    // The geometry of each block is evaluated once and shared between the
+    // solution spaces. The blocks are processed in parallel if OpenMP is enabled.
+    void performPreEvaluation();
+
+    // Release scratch related to pre evaluated basis functions and geometry
+    // in all blocks
+    void erasePreEvaluatedBasisFunctions();
+
+    // Limit the memory used for the pre evaluated geometry in each block,
+    // see IsogeometricVolBlock::setGeometryCacheSize()
+    void setGeometryCacheSize(int max_chunks);
+
   private:
     // The blocks which this block structured model consist of
     std::vector<shared_ptr<IsogeometricVolBlock> > vol_blocks_;
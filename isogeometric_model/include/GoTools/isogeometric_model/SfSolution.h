@@ -55,6 +55,17 @@ namespace Go
 
   class IsogeometricSfBlock;
 
+  struct preEvaluationGeomSf
+  {
+    // Storage for grid evaluation of the geometry surface, shared between
+    // the solution spaces of a block using the same Gauss points
+    std::vector<double> gauss_par1_;  // Gauss points in 1. parameter direction
+    std::vector<double> gauss_par2_;  // Gauss points in 2. parameter direction
+    std::vector<double> points_;   // Position of the surface in the Gauss points
+    std::vector<double> deriv_u_;  // 1. derivative of the surface in 1. par. dir. in the Gauss points
+    std::vector<double> deriv_v_;  // 1. derivative of the surface in 2. par. dir. in the Gauss points
+  };
+
   struct preEvaluationSf
   {
     // Storage for input to and results of the grid evaluation for basis functions
@@ -67,10 +78,8 @@ namespace Go
     std::vector<int>    left_u_;      // Index of first non-zero basis function in 1. par. dir.
     std::vector<int>    left_v_;      // Index of first non-zero basis function in 2. par. dir.
   
-    // Storage for grid evaluation of the geometry surface
-    std::vector<double> points_;   // Position of the surface in the Gauss points
-    std::vector<double> deriv_u_;  // 1. derivative of the surface in 1. par. dir. in the Gauss points
-    std::vector<double> deriv_v_;  // 1. derivative of the surface in 2. par. dir. in the Gauss points
+    // Grid evaluation of the geometry surface
+    shared_ptr<const preEvaluationGeomSf> geometry_;
   };
 
   // This class represents one solution in one block in a block-structured
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef __VOLDOFMAP_H
+#define __VOLDOFMAP_H
+
+
+#include <vector>
+#include "GoTools/utils/Point.h"
+#include "GoTools/isogeometric_model/IsogeometricVolModel.h"
+#include "GoTools/isogeometric_model/VolSolution.h"
+
+
+
+namespace Go
+{
+
+  // Interface for computation of element contributions used in the assembly
+  // driver of VolDofMap. The element matrix acts on each component of the
+  // solution separately.
+  class VolElementIntegrator
+  {
+  public:
+    // Destructor
+    virtual ~VolElementIntegrator() {}
+
+    // Compute the matrix and right hand side of one element in one block.
+    // The local enumeration is the one given by
+    // VolSolution::getElementEnumeration(). mat has size nb*nb, stored row
+    // by row, and rhs has size nb*dim where nb is the number of non-zero
+    // basis functions in the element and dim is the dimension of the
+    // solution. The function is called simultaneously from several
+    // threads for different blocks and must be thread safe.
+    virtual void elementMatrix(int block_idx, const VolSolution* solution,
+			       int elem_u, int elem_v, int elem_w,
+			       std::vector<double>& mat,
+			       std::vector<double>& rhs) = 0;
+  };
+
+  // Global enumeration of the degrees of freedom of one solution space in
+  // a block structured isogeometric volume model. Coefficients shared
+  // between blocks along common faces are given the same global number,
+  // and coefficients constrained by Dirichlet boundary conditions are
+  // removed from the set of equations. The class provides the sparsity
+  // pattern of the global system in compressed row storage (CSR) and an
+  // assembly driver that runs in parallel over the blocks.
+  // The spline spaces of neighbouring blocks must match, see
+  // IsogeometricVolModel::updateSolutionSplineSpace().
+
+  class VolDofMap
+  {
+  public:
+    // Constructor. Builds the enumeration for the given solution space
+    VolDofMap(IsogeometricVolModel* model, int solutionspace_idx);
+
+    // Destructor
+    ~VolDofMap();
+
+    // Rebuild the enumeration, needed after refinement or change of
+    // boundary conditions
+    void update();
+
+    // Number of blocks
+    int nmbBlocks() const
+    { return (int)blocks_.size(); }
+
+    // Number of distinct coefficients in the model, including those
+    // constrained by Dirichlet conditions
+    int nmbDofs() const
+    { return nmb_dofs_; }
+
+    // Number of unknowns in the global system
+    int nmbEquations() const
+    { return nmb_eqs_; }
+
+    // Dimension of the solution space
+    int dimension() const
+    { return dim_; }
+
+    // Global number of a local coefficient in a block
+    int globalDof(int block_idx, int local_idx) const
+    { return local_to_global_[block_idx][local_idx]; }
+
+    // Equation number of a local coefficient in a block, -1 if the
+    // coefficient is given by a Dirichlet condition
+    int equation(int block_idx, int local_idx) const
+    { return dof_to_eq_[local_to_global_[block_idx][local_idx]]; }
+
+    // Check if a global coefficient is given by a Dirichlet condition
+    bool isDirichlet(int dof) const
+    { return dof_to_eq_[dof] < 0; }
+
+    // Value of a coefficient given by a Dirichlet condition
+    Point dirichletValue(int dof) const;
+
+    // Sparsity pattern of the global system over the equations. The column
+    // indices of each row are sorted
+    const std::vector<int>& rowStart() const
+    { return row_start_; }
+
+    const std::vector<int>& columnIndex() const
+    { return col_idx_; }
+
+    // Number of colours in the block colouring. Blocks with equal
+    // colour do not share any coefficients
+    int nmbColours() const
+    { return (int)colour_blocks_.size(); }
+
+    // Assemble the global system. Requires pre evaluation to be performed
+    // in the solution space of all blocks. The element contributions are
+    // computed by the integrator. Contributions from Dirichlet coefficients
+    // are moved to the right hand side. On return, values has one entry for
+    // each entry in columnIndex() and rhs has size nmbEquations()*dimension(),
+    // with the components of each equation stored consecutively.
+    // Blocks with the same colour are assembled in parallel.
+    void assemble(VolElementIntegrator& integrator,
+		  std::vector<double>& values,
+		  std::vector<double>& rhs) const;
+
+    // Distribute a solution of the global system, stored as the right hand
+    // side in assemble(), to the solution volumes of all blocks. The
+    // Dirichlet coefficients are set from the boundary conditions.
+    void setSolution(const std::vector<double>& solution) const;
+
+  private:
+    // The model and the solution space we work on
+    IsogeometricVolModel* model_;
+    int solutionspace_idx_;
+    std::vector<shared_ptr<IsogeometricVolBlock> > blocks_;
+
+    int dim_;
+    int nmb_dofs_;
+    int nmb_eqs_;
+
+    // Global number of each local coefficient, for each block
+    std::vector<std::vector<int> > local_to_global_;
+
+    // Equation number of each global coefficient, -1 if Dirichlet
+    std::vector<int> dof_to_eq_;
+
+    // Values of the Dirichlet coefficients, dim_ entries for each
+    // global coefficient. Only entries for Dirichlet coefficients are set
+    std::vector<double> dirichlet_val_;
+
+    // Compressed row storage of the global system
+    std::vector<int> row_start_;
+    std::vector<int> col_idx_;
+
+    // The blocks of each colour
+    std::vector<std::vector<int> > colour_blocks_;
+
+    // Merge coefficients across block interfaces
+    void buildEnumeration();
+
+    // Fetch Dirichlet conditions and number the equations
+    void buildEquations();
+
+    // Compute the sparsity pattern
+    void buildPattern();
+
+    // Colour the blocks such that blocks sharing coefficients get
+    // different colours
+    void buildColouring();
+
+  };   // end class VolDofMap
+
+} // end namespace Go
+
+
+#endif    // #ifndef __VOLDOFMAP_H
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef __VOLGEOMETRYGRID_H
+#define __VOLGEOMETRYGRID_H
+
+
+#include <vector>
+#include <list>
+#include <memory>
+#include "GoTools/trivariate/SplineVolume.h"
+
+
+
+namespace Go
+{
+
+  // Grid evaluation of the geometry volume of a block in a set of Gauss
+  // points, shared between all solution spaces of the block that use the
+  // same Gauss points. The Gauss points are divided into chunks, one for
+  // each element (knot interval box) of the geometry volume. All chunks are
+  // evaluated at once unless a maximum number of cached chunks is given. In
+  // that case the chunks are evaluated on demand and the least recently
+  // used chunk is released when the limit is exceeded, keeping the memory
+  // bounded on fine refinements.
+  class VolGeometryGrid
+  {
+  public:
+    // Position and 1. derivatives of the geometry volume in the Gauss points
+    // of one chunk. Points are enumerated with the 1. parameter direction
+    // running fastest, and each entry has dimension dim_.
+    struct Chunk
+    {
+      int first_[3];   // Index of first Gauss point in chunk, each par. dir.
+      int nmb_[3];     // Number of Gauss points in chunk, each par. dir.
+      int dim_;        // Dimension of geometry volume
+      std::vector<double> points_;   // Position of the volume
+      std::vector<double> deriv_u_;  // 1. derivative of the volume in 1. par. dir.
+      std::vector<double> deriv_v_;  // 1. derivative of the volume in 2. par. dir.
+      std::vector<double> deriv_w_;  // 1. derivative of the volume in 3. par. dir.
+
+      // Check if a Gauss point, given by its index in each parameter
+      // direction, belongs to this chunk
+      bool contains(int q1, int q2, int q3) const
+      {
+	return (q1 >= first_[0] && q1 < first_[0] + nmb_[0] &&
+		q2 >= first_[1] && q2 < first_[1] + nmb_[1] &&
+		q3 >= first_[2] && q3 < first_[2] + nmb_[2]);
+      }
+
+      // Position of a Gauss point belonging to this chunk in the arrays
+      int position(int q1, int q2, int q3) const
+      {
+	return dim_*(((q3 - first_[2])*nmb_[1] + q2 - first_[1])*nmb_[0] +
+		     q1 - first_[0]);
+      }
+    };
+
+    // Constructor. The Gauss points must be increasing in each parameter
+    // direction. If max_chunks is positive, the chunks are evaluated on
+    // demand and at most max_chunks chunks are kept.
+    VolGeometryGrid(shared_ptr<SplineVolume> geom_vol,
+		    const std::vector<double>& par_u,
+		    const std::vector<double>& par_v,
+		    const std::vector<double>& par_w,
+		    int max_chunks = 0);
+
+    // Destructor
+    ~VolGeometryGrid();
+
+    // Check if the grid is defined by the given Gauss points
+    bool sameParameters(const std::vector<double>& par_u,
+			const std::vector<double>& par_v,
+			const std::vector<double>& par_w) const;
+
+    // Number of Gauss points in a given parameter direction
+    int nmbGaussPoints(int pardir) const;
+
+    // Number of chunks in a given parameter direction
+    int nmbChunks(int pardir) const;
+
+    // Maximum number of cached chunks, 0 if all chunks are kept
+    int maxChunks() const;
+
+    // Number of chunks currently evaluated
+    int nmbEvaluatedChunks() const;
+
+    // Fetch the chunk containing a given Gauss point. The chunk is
+    // evaluated if necessary. The returned chunk stays valid even if it
+    // is released from the cache. The function is thread safe.
+    shared_ptr<const Chunk> getChunk(int q1, int q2, int q3) const;
+
+    // Position and 1. derivatives of the geometry volume in a given Gauss
+    // point. derivs must have room for 4*dim entries ordered as position,
+    // derivative in 1., 2. and 3. parameter direction.
+    void derivsInGaussPoint(int q1, int q2, int q3, double derivs[]) const;
+
+  private:
+    // Evaluate the geometry volume in a specified chunk
+    shared_ptr<Chunk> evaluateChunk(int c1, int c2, int c3) const;
+
+    // The geometry volume
+    shared_ptr<SplineVolume> volume_;
+
+    // Gauss points in each parameter direction
+    std::vector<double> par_[3];
+
+    // Index of first Gauss point in each chunk, each par. dir. The last
+    // entry is the number of Gauss points
+    std::vector<int> chunk_start_[3];
+
+    // Index of the chunk containing each Gauss point, each par. dir.
+    std::vector<int> chunk_of_[3];
+
+    // Maximum number of cached chunks, 0 if all chunks are kept
+    int max_chunks_;
+
+    // Evaluated chunks, enumerated with the 1. parameter direction
+    // running fastest. Empty pointer if the chunk is not evaluated
+    mutable std::vector<shared_ptr<Chunk> > chunks_;
+
+    // Evaluated chunks, the most recently used first. Only used if the
+    // number of cached chunks is bounded
+    mutable std::list<int> lru_;
+
+    // Position of each evaluated chunk in lru_
+    mutable std::vector<std::list<int>::iterator> lru_pos_;
+  };
+
+} // end namespace Go
+
+
+#endif    // #ifndef __VOLGEOMETRYGRID_H
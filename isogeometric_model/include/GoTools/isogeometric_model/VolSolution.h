@@ -48,6 +48,7 @@
 #include "GoTools/isogeometric_model/VolPointBdCond.h"
 #include "GoTools/isogeometric_model/BdConditionType.h"
 #include "GoTools/isogeometric_model/BdCondFunctor.h"
+#include "GoTools/isogeometric_model/VolGeometryGrid.h"
 #include <vector>
 #include <memory>
 
@@ -70,12 +71,54 @@ namespace Go
     std::vector<int>    left_v_;      // Index of first non-zero basis function in 2. par. dir.
     std::vector<int>    left_w_;      // Index of first non-zero basis function in 3. par. dir.
 
-    // Storage for grid evaluation of the geometry surface
-    // Sizes: gauss_par1_.size() * gauss_par1_.size() * gauss_par1_.size() * dim.
-    std::vector<double> points_;   // Position of the surface in the Gauss points.
-    std::vector<double> deriv_u_;  // 1. derivative of the surface in 1. par. dir. in the Gauss points
-    std::vector<double> deriv_v_;  // 1. derivative of the surface in 2. par. dir. in the Gauss points
-    std::vector<double> deriv_w_;  // 1. derivative of the surface in 3. par. dir. in the Gauss points
+    // Quadrature weights corresponding to the Gauss points. Empty if the
+    // pre evaluation was performed without weights.
+    std::vector<double> gauss_wgt1_;
+    std::vector<double> gauss_wgt2_;
+    std::vector<double> gauss_wgt3_;
+
+    // Index of the first Gauss point in each element (knot interval
+    // containing Gauss points). The last entry is the number of Gauss points.
+    std::vector<int>    elem_gauss_u_;
+    std::vector<int>    elem_gauss_v_;
+    std::vector<int>    elem_gauss_w_;
+
+    // Grid evaluation of the geometry volume in the Gauss points. Shared
+    // with the other solution spaces of the block using the same points
+    shared_ptr<VolGeometryGrid> geometry_;
+  };
+
+  struct ElementBasisVol
+  {
+    // Basis functions and geometry in all Gauss points of one element,
+    // stored as contiguous arrays. Gauss points and basis functions are
+    // both enumerated with the 1. parameter direction running fastest.
+    // The entry for Gauss point q and local basis function i is found in
+    // position q*nmbBasisFunctions() + i.
+    int first_gauss_[3];  // Index of first Gauss point in element, each par. dir.
+    int nmb_gauss_[3];    // Number of Gauss points in element, each par. dir.
+    int first_coef_[3];   // Index of first non-zero basis function, each par. dir.
+    int order_[3];        // Number of non-zero basis functions, each par. dir.
+
+    std::vector<double> basis_;     // Value of the non-zero basis functions
+    std::vector<double> deriv_u_;   // 1. derivative of the basis functions in 1. par. dir.
+    std::vector<double> deriv_v_;   // 1. derivative of the basis functions in 2. par. dir.
+    std::vector<double> deriv_w_;   // 1. derivative of the basis functions in 3. par. dir.
+
+    // Jacobian matrix of the geometry volume, 9 entries for each Gauss
+    // point. Row k holds the derivative in the k-th parameter direction.
+    std::vector<double> jacobian_;
+    std::vector<double> jac_det_;   // Jacobian determinant in each Gauss point
+
+    int nmbGaussPoints() const
+    {
+      return nmb_gauss_[0]*nmb_gauss_[1]*nmb_gauss_[2];
+    }
+
+    int nmbBasisFunctions() const
+    {
+      return order_[0]*order_[1]*order_[2];
+    }
   };
 
   // This class represents one solution in one block in a block-structured
@@ -193,6 +236,45 @@ namespace Go
     // pre evaluated values are removed, and this function must be called again
     virtual void performPreEvaluation(std::vector<std::vector<double> >& Gauss_par);
 
+    // Pre evaluation as above, additionally storing the quadrature weights
+    // corresponding to the Gauss parameters. The weights are required by
+    // getElementStiffnessMatrix() and getElementMassMatrix()
+    void performPreEvaluation(std::vector<std::vector<double> >& Gauss_par,
+			      std::vector<std::vector<double> >& Gauss_wgt);
+
+    // Number of elements, i.e. knot intervals containing Gauss points,
+    // in a given parameter direction.
+    // Requires pre evaluation to be performed.
+    int nmbElements(int pardir) const;
+
+    // Get value and 1. derivative of all non-zero basis functions, and the
+    // Jacobian of the geometry, in all Gauss points of one element.
+    // The storage in result is reused, one instance may serve all elements.
+    // Requires pre evaluation to be performed.
+    void getElementBasisFunctions(int elem_u, int elem_v, int elem_w,
+				  ElementBasisVol& result) const;
+
+    // Local enumeration of the coefficients of all non-zero basis functions
+    // in one element, in the order used by ElementBasisVol.
+    // Requires pre evaluation to be performed.
+    void getElementEnumeration(int elem_u, int elem_v, int elem_w,
+			       std::vector<int>& enumeration) const;
+
+    // Element stiffness matrix of the Laplace operator, the integral of
+    // grad(N_i)*grad(N_j) over the element in physical space. The matrix
+    // is stored row by row, the local enumeration of basis functions is
+    // the one of ElementBasisVol. For a non-rational solution volume the
+    // matrix is computed by sum factorization, O(p^7) operations.
+    // Requires pre evaluation with quadrature weights.
+    void getElementStiffnessMatrix(int elem_u, int elem_v, int elem_w,
+				   std::vector<double>& stiffness) const;
+
+    // Element mass matrix, the integral of N_i*N_j over the element in
+    // physical space. Storage and evaluation as for the stiffness matrix.
+    // Requires pre evaluation with quadrature weights.
+    void getElementMassMatrix(int elem_u, int elem_v, int elem_w,
+			      std::vector<double>& mass) const;
+
     // Get value and 1. derivative of all non-zero rational basis funtions
     // in the given Gauss point
     // Requires pre evaluation to be performed.
@@ -343,6 +425,16 @@ namespace Go
     // Pointer to the block to which this boundary condition belongs
     IsogeometricVolBlock* parent_;
 
+    // Fetch the Gauss point ranges and the first non-zero basis function
+    // of an element
+    void elementRange(int elem_u, int elem_v, int elem_w,
+		      int first_gauss[], int nmb_gauss[], int first_coef[]) const;
+
+    // Integrate the stiffness or mass matrix over an element using the
+    // full tensor product basis. Used for rational solution volumes.
+    void elementMatrixFullTensor(int elem_u, int elem_v, int elem_w,
+				 bool stiffness, std::vector<double>& mat) const;
+
     void neighbourInfo(BlockSolution* other, vector<int>& faces, vector<int>& faces_other,
 		       vector<int>& orientation, vector<bool>& same_dir_order,
 		       vector<bool>& space_matches) const;
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef PRMULTIGRID_H
+#define PRMULTIGRID_H
+
+#include "GoTools/parametrization/PrMatSparse.h"
+#include "GoTools/parametrization/PrVec.h"
+#include <vector>
+
+/*<PrMultigrid-syntax: */
+
+/** PrMultigrid - Implements an algebraic multigrid method for solving
+ * the sparse linear systems of mesh parametrization. A hierarchy of
+ * coarser systems is made by smoothed aggregation of strongly
+ * connected unknowns, with Galerkin coarse matrices. One V-cycle with
+ * symmetric Gauss-Seidel smoothing and a direct solve on the coarsest
+ * level is used as preconditioner for BiCGStab, as the matrices are
+ * not symmetric in general. The number of iterations is then nearly
+ * independent of the number of unknowns.
+ * The hierarchy is made once by setup() and shared by all right hand
+ * sides. The solve functions are thread safe.
+ */
+class PrMultigrid
+{
+protected:
+
+  double tolerance_;
+  int max_iterations_;
+  int coarse_size_;
+  int nmb_smooth_;
+
+  int it_count_;
+  double cpu_time_;
+  bool converged_;
+
+  struct Level
+  {
+    PrMatSparse A_;      // The system matrix at this level
+    std::vector<int> diag_;  // Index of the diagonal element in each row
+    PrMatSparse P_;      // Prolongation from the next coarser level
+    PrMatSparse R_;      // Restriction to the next coarser level
+  };
+
+  std::vector<Level> levels_;
+
+  // LU factorization of the coarsest matrix, if it is small enough
+  std::vector<double> lu_;
+  std::vector<int> pivot_;
+
+  void cycle(int level, PrVec& x, const PrVec& b,
+	     std::vector<PrVec>& work) const;
+
+  void smooth(int level, PrVec& x, const PrVec& b, bool forward) const;
+
+  void coarseSolve(PrVec& x, const PrVec& b) const;
+
+  void precondition(const PrVec& r, PrVec& z, 
+		    std::vector<PrVec>& work) const;
+
+  bool solveOne(PrVec& x, const PrVec& b, int& it_count) const;
+
+public:
+  /// Constructor
+  PrMultigrid();
+  /// Destructor
+  ~PrMultigrid() {}
+
+  /// Set the tolerance for the residual.
+  void setTolerance(double tolerance = 1.0e-6) {tolerance_ = tolerance;}
+
+  /// Set the maximum number of iterations.
+  void setMaxIterations(int max_iterations)
+           {max_iterations_ = max_iterations;}
+
+  /// Stop coarsening when a level has at most this number of unknowns.
+  void setCoarseSize(int coarse_size = 400) {coarse_size_ = coarse_size;}
+
+  /// Set the number of Gauss-Seidel sweeps before and after the
+  /// coarse grid correction.
+  void setSmoothingSteps(int nmb_smooth = 1) {nmb_smooth_ = nmb_smooth;}
+
+  /// Make the hierarchy of coarser systems for the matrix A. Must be
+  /// called before solve(). The diagonal of A must be nonzero.
+  void setup(const PrMatSparse& A);
+
+  /// Number of levels in the hierarchy, including the given matrix.
+  int numLevels() const {return (int)levels_.size();}
+
+  /// Solve the linear system for the matrix given to setup(),
+  /// replacing the start vector with the solution.
+  void solve(PrVec& x, const PrVec& b);
+
+  /// Solve the linear system for two right hand sides concurrently,
+  /// in parallel if OpenMP is enabled. The iteration count is the
+  /// largest of the two.
+  void solve(PrVec& x1, const PrVec& b1, PrVec& x2, const PrVec& b2);
+
+  /// Get the number of iterations spent for the last call of 'solve()'.
+  int getItCount() {return it_count_; }
+
+  /// Get the CPU time spent for the last call of 'solve()'.
+  double getCPUTime() {return cpu_time_; }
+ 
+  /// Check if the last call of 'solve()' managed to converge to a solution.
+  bool converged() {return converged_; }
+};
+
+/*>PrMultigrid-syntax: */
+
+/*Class:PrMultigrid
+
+Name:              PrMultigrid
+Syntax:	           @PrMultigrid-syntax
+Keywords:
+Description:       This class implements an algebraic multigrid
+                   preconditioned BiCGStab method for solving sparse
+                   linear systems.
+Member functions:
+                   "setTolerance()" --\\
+                   Set the tolerance for the residual.
+
+                   "setMaxIterations()" --\\
+                   Set the maximum number of iterations.
+
+                   "setup(const PrMatSparse& A)" --\\
+                   Make the hierarchy of coarser systems.
+
+                   "solve(PrVec& x, const PrVec& b)" --\\
+                   Solve the linear system, replacing the start vector
+                   with the solution.
+
+Constructors:
+Files:
+Example:
+
+See also:
+Developed by:      SINTEF Applied Mathematics, Oslo, Norway
+*/
+
+#endif // PRMULTIGRID_H
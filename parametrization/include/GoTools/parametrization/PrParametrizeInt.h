@@ -50,6 +50,11 @@ enum PrParamStartVector {
   PrFROMUV                = 2
 };
 
+enum PrParamSolver {
+  PrBICGSTAB              = 1,
+  PrMULTIGRID             = 2
+};
+
 /** This class implements an algorithm for creating a
  * parametrization in \f$R^2\f$ of the interior of
  * a given embedding of a planar graph in \f$R^3\f$.
@@ -70,6 +75,7 @@ protected:
 
   double                 tolerance_;
   PrParamStartVector   startvectortype_;
+  PrParamSolver        solvertype_;
 
   shared_ptr<PrOrganizedPoints> g_;
 
@@ -89,6 +95,25 @@ protected:
 
   virtual bool makeWeights(int i) = 0;
 
+  /// Compute the weights of the interior node i for the given
+  /// neighbours, like makeWeights(), without using the work arrays
+  /// neighbours_ and weights_. This allows the weights of different
+  /// nodes to be computed concurrently. Implemented by the derived
+  /// classes where hasLocalWeights() returns true.
+  virtual bool makeLocalWeights(int i, const vector<int>& neighbours,
+				vector<double>& weights) const
+  { return false; }
+
+  /// Whether makeLocalWeights() is implemented.
+  virtual bool hasLocalWeights() const
+  { return false; }
+
+  /// Find the neighbours and weights of all interior nodes, in
+  /// parallel if makeLocalWeights() is implemented and OpenMP is
+  /// enabled. The entries of boundary nodes are left empty.
+  void makeInteriorWeights(vector< vector<int> >& neighbours,
+			   vector< vector<double> >& weights);
+
   const vector< vector<double> >& getAllWeights() const
   {
       return allWeights_;
@@ -112,6 +137,14 @@ public:
   void setStartVectorKind(PrParamStartVector svtype = PrBARYCENTRE)
     {startvectortype_ = svtype;}
 
+  /// Choose the solver for the linear systems in parametrize().
+  /// PrBICGSTAB is plain Bi-CGSTAB. PrMULTIGRID is Bi-CGSTAB 
+  /// preconditioned by algebraic multigrid, see PrMultigrid, which
+  /// needs far fewer iterations for large graphs. With PrMULTIGRID
+  /// the u and v systems are solved concurrently.
+  void setSolverKind(PrParamSolver solvertype = PrBICGSTAB)
+    {solvertype_ = solvertype;}
+
   /// Set tolerance for Bi-CGSTAB.
   void setBiCGTolerance(double tolerance = 1.0e-6) {tolerance_ = tolerance;}
 
@@ -51,6 +51,10 @@ class PrPrmEDDHLS : public PrParametrizeInt
 {
 protected:
   virtual bool makeWeights(int i);
+  virtual bool makeLocalWeights(int i, const vector<int>& neighbours,
+				vector<double>& weights) const;
+  virtual bool hasLocalWeights() const
+  { return true; }
 
 public:
   /// Default constructor 
@@ -58,6 +58,14 @@ protected:
   virtual bool makeWeights(int i);
   bool         localParam(int i);
 
+  virtual bool makeLocalWeights(int i, const vector<int>& neighbours,
+				vector<double>& weights) const;
+  virtual bool hasLocalWeights() const
+  { return true; }
+  bool         localParam(int i, const vector<int>& neighbours,
+			  vector<double>& u, vector<double>& v,
+			  vector<double>& alpha, vector<double>& len) const;
+
 public:
   /// Default constructor 
   PrPrmShpPres();
@@ -87,7 +87,21 @@ public:
     const double& operator [] (int i) const {return a_[i];}
 
     /// Compute inner product with another vector of the same length.
-    double inner(const PrVec& x);
+    double inner(const PrVec& x) const;
+
+    /// Add a multiple of another vector, this = this + a*x.
+    void axpy(double a, const PrVec& x);
+    /// Scale and add another vector, this = x + a*this.
+    void aypx(double a, const PrVec& x);
+    /// Add a multiple of another vector, this = this + a*x, and
+    /// return the inner product of the result with itself. The
+    /// vectors are traversed once.
+    double axpyInner(double a, const PrVec& x);
+    /// Set this = x + a*y and return the inner product of the result
+    /// with itself. The vectors are traversed once.
+    double setSumInner(const PrVec& x, double a, const PrVec& y);
+    /// Exchange the elements with another vector.
+    void swap(PrVec& x) {a_.swap(x.a_);}
 
     /// Read vector elements from stream 'is'.
     void read(std::istream& is);
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BEZIERVOLUMECACHE_H
+#define _BEZIERVOLUMECACHE_H
+
+#include "GoTools/geometry/BezierExtraction.h"
+#include "GoTools/utils/Point.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+class SplineVolume;
+
+/// Element-wise evaluation of a SplineVolume through Bezier extraction.
+/// This is the trivariate counterpart of BezierSurfaceCache. The Bezier
+/// coefficients of all elements are computed once, without changing
+/// the volume, and evaluation on an element is then a dense contraction
+/// with the Bernstein polynomials in each parameter direction.
+/// For rational volumes the homogeneous coefficients are stored.
+/// All evaluation functions are const and may be called concurrently.
+class GO_API BezierVolumeCache
+{
+public:
+    /// Default constructor, making an empty cache
+    BezierVolumeCache()
+	: dim_(0), kdim_(0), rational_(false), elemsize_(0)
+    {}
+
+    /// Constructor
+    /// \param vol the volume to extract
+    explicit BezierVolumeCache(const SplineVolume& vol)
+    { setVolume(vol); }
+
+    /// Compute the Bezier coefficients of all elements of a volume
+    /// \param vol the volume to extract
+    void setVolume(const SplineVolume& vol);
+
+    /// The dimension of the geometry space
+    int dimension() const
+    { return dim_; }
+
+    /// Whether the volume is rational
+    bool rational() const
+    { return rational_; }
+
+    /// The Bezier extraction in a parameter direction, 0=u, 1=v, 2=w
+    const BezierExtraction& extraction(int pardir) const
+    { return ext_[pardir]; }
+
+    /// The number of elements in a parameter direction
+    int numElem(int pardir) const
+    { return ext_[pardir].numElem(); }
+
+    /// The element containing a parameter value in the given direction
+    int element(int pardir, double par) const
+    { return ext_[pardir].element(par); }
+
+    /// The Bezier coefficients of an element, order_u*order_v*order_w
+    /// coefficients with the u index running fastest, then v. For
+    /// rational volumes the coefficients are homogeneous.
+    const double* bezierCoefs(int eu, int ev, int ew) const
+    {
+	return &coefs_[((ew*numElem(1) + ev)*numElem(0) + eu)*elemsize_];
+    }
+
+    /// Evaluate the volume at a parameter triple inside the given element
+    void point(Point& pt, int eu, int ev, int ew,
+	       double upar, double vpar, double wpar) const;
+
+    /// Evaluate the volume and its derivatives at a parameter triple
+    /// inside the given element. The points are ordered as in
+    /// SplineVolume::point(), i.e. S, du, dv, dw, duu, duv, duw, dvv, ...
+    /// \param pts the evaluated points, resized if necessary
+    /// \param derivs the number of derivatives to compute
+    void point(std::vector<Point>& pts, int eu, int ev, int ew,
+	       double upar, double vpar, double wpar, int derivs) const;
+
+    /// Evaluate the volume and its derivatives in a grid of parameter
+    /// values on one element. The result contains, for each parameter
+    /// triple with the u parameter running fastest and then v, the
+    /// (derivs+1)*(derivs+2)*(derivs+3)/6 derivatives, each of size
+    /// dimension(), in the same order as point().
+    void elementGrid(int eu, int ev, int ew,
+		     const std::vector<double>& upars,
+		     const std::vector<double>& vpars,
+		     const std::vector<double>& wpars, int derivs,
+		     std::vector<double>& result) const;
+
+private:
+    int dim_;
+    int kdim_;
+    bool rational_;
+    int elemsize_;
+    BezierExtraction ext_[3];
+    std::vector<double> coefs_;   // elemsize_ values per element
+
+    // Contract the coefficients of an element with precomputed
+    // Bernstein values, giving homogeneous derivatives in res. The
+    // scratch array tmp must hold
+    // (derivs+1)*order_w*(order_v+derivs+1) homogeneous coefficients.
+    void contract(const double* coefs, const double* bu, const double* bv,
+		  const double* bw, int derivs, double* tmp,
+		  double* res) const;
+};
+
+} // namespace Go
+
+#endif // _BEZIERVOLUMECACHE_H
@@ -423,6 +423,7 @@ public:
 	    double fuzzy = DEFAULT_PARAMETER_EPSILON) const; 
 
     // inherited from ParamVolume
+    // For many points, VolumePointLocator is faster.
     virtual void closestPoint(const Point& pt,
 			      double&        clo_u,
 			      double&        clo_v, 
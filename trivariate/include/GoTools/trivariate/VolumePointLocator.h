@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _VOLUMEPOINTLOCATOR_H
+#define _VOLUMEPOINTLOCATOR_H
+
+#include "GoTools/trivariate/BezierVolumeCache.h"
+#include "GoTools/utils/Point.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+class SplineVolume;
+
+/// Closest point and point inversion for a SplineVolume using a cached
+/// hierarchy of the Bezier elements of the volume. The bounding box of
+/// each element is computed from its Bezier coefficients, and the boxes
+/// are organized in a bounding volume hierarchy. For a given point, the
+/// elements are visited in the order of increasing distance to their
+/// boxes, and a Newton iteration restricted to the element is performed
+/// until no remaining box can contain a closer point.
+/// The locator keeps its own copy of the element data, so the volume
+/// may be deleted after construction. All query functions are const
+/// and may be called concurrently.
+class GO_API VolumePointLocator
+{
+public:
+    /// Constructor
+    /// \param vol the volume, must be of dimension 3
+    explicit VolumePointLocator(const SplineVolume& vol);
+
+    /// The number of Bezier elements of the volume
+    int numElements() const
+    { return (int)elem_boxes_.size()/6; }
+
+    /// The element cache used for evaluation
+    const BezierVolumeCache& cache() const
+    { return cache_; }
+
+    /// Compute the closest point on the volume, see
+    /// ParamVolume::closestPoint()
+    /// \param pt the point
+    /// \param clo_u u parameter of the closest point
+    /// \param clo_v v parameter of the closest point
+    /// \param clo_w w parameter of the closest point
+    /// \param clo_pt the closest point
+    /// \param clo_dist distance between pt and clo_pt
+    /// \param epsilon geometric tolerance
+    /// \return 1 if the point lies inside the volume, 0 if it lies on
+    /// the volume boundary and -1 if it lies outside
+    int closestPoint(const Point& pt, double& clo_u, double& clo_v,
+		     double& clo_w, Point& clo_pt, double& clo_dist,
+		     double epsilon) const;
+
+    /// Compute the parameter values of a set of points. The points are
+    /// processed in parallel when OpenMP is enabled. For points outside
+    /// the volume, the parameters of the closest point are returned.
+    /// \param pts the points
+    /// \param epsilon geometric tolerance
+    /// \param params three parameter values for each point
+    /// \param dists distance from each point to the volume
+    /// \param inside for each point, 1 if inside, 0 if on the boundary
+    /// and -1 if outside the volume
+    void inverseMap(const std::vector<Point>& pts, double epsilon,
+		    std::vector<double>& params, std::vector<double>& dists,
+		    std::vector<int>& inside) const;
+
+private:
+    struct Node
+    {
+	double low_[3], high_[3];
+	int first_;  // First element of a leaf, the right child of an inner node
+	int count_;  // Number of elements in a leaf, 0 for an inner node
+    };
+
+    BezierVolumeCache cache_;
+    double domain_[6];
+    std::vector<double> elem_boxes_;  // low and high corner, 6 per element
+    std::vector<int> elem_idx_;       // Element index in leaf order
+    std::vector<Node> nodes_;
+
+    int buildNode(int first, int last, const std::vector<double>& centroids);
+
+    // Start parameter for the iteration in one element
+    void elementSeed(const double* pt, int eu, int ev, int ew,
+		     double par[]) const;
+
+    // Minimize the distance to the point over one element, starting in
+    // the given parameter. Returns the squared distance. The vectors
+    // pts and pts2 are scratch space for evaluation.
+    double elementClosest(const double* pt, int eu, int ev, int ew,
+			  double par[], std::vector<Point>& pts,
+			  std::vector<Point>& pts2) const;
+};
+
+} // namespace Go
+
+#endif // _VOLUMEPOINTLOCATOR_H
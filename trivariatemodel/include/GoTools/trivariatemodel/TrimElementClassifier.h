@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _TRIMELEMENTCLASSIFIER_H
+#define _TRIMELEMENTCLASSIFIER_H
+
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+  class ftVolume;
+  class SplineVolume;
+  class RayCaster;
+
+  /// \brief Classification of all polynomial elements of a trimmed
+  /// spline volume with respect to the trimming surfaces, as needed in
+  /// immersed isogeometric analysis.
+  ///
+  /// The status of every element is computed once in the constructor
+  /// and stored. The trimming faces are split in pieces of about the
+  /// element size, and the boxes of the pieces are organized in a
+  /// bounding volume hierarchy. An element is a cut candidate if the box
+  /// of its control points overlaps a piece. The other elements are
+  /// inside or outside, decided by classifying their midpoints. A cut
+  /// candidate is classified in the midpoints of a regular grid of
+  /// sub-cells, giving a quadrature mask for the cut elements.
+  /// The box tests and evaluations run in parallel if OpenMP is enabled,
+  /// and the point classification is done by RayCaster::classify().
+  /// The status codes are the same as for ftVolume::ElementBoundaryStatus(),
+  /// elements are counted according to distinct knot values with
+  /// the u index running fastest, then v.
+
+  class GO_API TrimElementClassifier
+  {
+  public:
+    /// Constructor. Classifies all elements of the volume
+    /// \param vol the trimmed volume, the geometry must be a spline volume
+    /// \param sub_div the number of sub-cells in each parameter direction
+    /// of a cut candidate
+    /// \param exact if true, cut candidates with the same classification
+    /// in all sub-cells are checked by ftVolume::ElementOnBoundary(), 
+    /// otherwise they get the status of the sub-cells. A trimming surface
+    /// passing between the sub-cell midpoints is only found if exact is true
+    TrimElementClassifier(ftVolume* vol, int sub_div = 4, bool exact = false);
+
+    /// Destructor
+    ~TrimElementClassifier();
+
+    /// The number of elements, 0 if the volume is not a spline volume
+    int numElements() const
+    {
+      return (int)status_.size();
+    }
+
+    /// The status of an element
+    /// \return -1: Element index out of range
+    ///          0: Outside trimmed volume
+    ///          1: Cut by the trimming surfaces
+    ///          2: Internal to trimmed volume
+    int elementStatus(int elem_ix) const
+    {
+      return (elem_ix < 0 || elem_ix >= (int)status_.size()) ? -1 :
+	status_[elem_ix];
+    }
+
+    /// The status of all elements, see elementStatus(int)
+    const std::vector<int>& elementStatus() const
+    {
+      return status_;
+    }
+
+    /// The indices of the elements cut by the trimming surfaces
+    void getCutElements(std::vector<int>& elem_ix) const;
+
+    /// The number of sub-cells in each parameter direction of a cut element
+    int subDivision() const
+    {
+      return sub_div_;
+    }
+
+    /// Quadrature mask of an element. The mask is empty if the element is
+    /// not cut, otherwise it has one entry for each of the sub_div^3 
+    /// sub-cells, u running fastest, then v. The entry is 1 if the
+    /// midpoint of the sub-cell is inside the trimmed volume or on its
+    /// boundary, 0 if it is outside.
+    const std::vector<char>& subCellMask(int elem_ix) const;
+
+    /// Check if a number of parameter triples are inside the trimmed
+    /// volume. Batched version of ftVolume::ParamInVolume()
+    /// \param params parameter triples, stored consecutively
+    /// \retval result for each triple: 1 if inside, 0 if on the boundary
+    /// within the gap tolerance, -1 if outside
+    void paramInVolume(const std::vector<double>& params,
+		       std::vector<int>& result) const;
+
+  private:
+    struct Node
+    {
+      double low_[3], high_[3];
+      int first_;  // First box of a leaf, the right child of an inner node
+      int count_;  // Number of boxes in a leaf, 0 for an inner node
+    };
+
+    ftVolume* vol_;
+    SplineVolume* spline_;
+    RayCaster* caster_;
+    double tol_;
+    int sub_div_;
+    bool exact_;
+
+    std::vector<int> status_;
+    std::vector<int> mask_idx_;  // Index in masks_ for cut elements, else -1
+    std::vector<std::vector<char> > masks_;
+    std::vector<char> empty_mask_;
+
+    // Boxes of the trimming pieces, low and high corner in 6 doubles
+    std::vector<double> pieces_;
+    std::vector<Node> nodes_;
+
+    void classify();
+
+    void makePieces(double size);
+
+    int buildNode(int first, int last, std::vector<int>& perm,
+		  const std::vector<double>& centroids);
+
+    bool overlapsPieces(const double* low, const double* high) const;
+  };
+
+} // namespace Go
+
+
+#endif // _TRIMELEMENTCLASSIFIER_H
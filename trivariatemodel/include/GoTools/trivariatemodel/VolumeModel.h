@@ -248,6 +248,17 @@ namespace Go
   /// Ensure that the blocks in the model has got common spline spaces
   void makeCommonSplineSpaces();
 
+  /// Replace the trimmed, regular blocks of the model by non-trimmed
+  /// spline volumes, see ftVolume::untrimRegular()
+  /// \param parallel if true, blocks that neither are adjacent nor share
+  /// an adjacent block are untrimmed concurrently. A block is untrimmed
+  /// after its adjacent blocks with a lower index, and the topology is
+  /// updated serially in the order of the blocks. The result equals
+  /// the serial one
+  /// \return number of untrimmed blocks
+  int untrimRegularVolumes(int degree, bool accept_degen = false,
+			   bool parallel = false);
+
   /// Ensure exact match between corresponding coefficients
   void averageCorrespondingCoefs();
 
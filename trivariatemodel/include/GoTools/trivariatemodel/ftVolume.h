@@ -303,6 +303,7 @@ namespace Go
     /// Note that a touch with the boundaries of the underlying volume
     /// is not consdered a boundary intersection while touching a trimming
     /// surface is seen as an intersection
+    /// TrimElementClassifier computes the status of all elements at once
    int ElementBoundaryStatus(int elem_ix);
 
     /// Information about whether or not the volume is trimmed and how it
@@ -338,6 +339,27 @@ namespace Go
     /// Modify a regularized, possibly trimmed volume to become non-trimmed
     bool untrimRegular(int degree, bool accept_degen = false);
 
+    /// First step of untrimRegular(). Create the non-trimmed parametric 
+    /// volume without modifying this volume. The faces of this volume and
+    /// their twins are inspected, thus adjacent volumes should not be
+    /// processed concurrently.
+    /// \param degree polynomial degree of the Coons volume
+    /// \param accept_degen whether degenerate volumes are accepted
+    /// \param sorted_sfs boundary surfaces sorted as umin, umax, vmin, 
+    /// vmax, wmin, wmax, to be passed to setUntrimmedVolume()
+    /// \param loft_sequence to be passed to setUntrimmedVolume()
+    /// \return the new volume, empty if it could not be created
+    shared_ptr<ParamVolume> 
+      createUntrimmedVolume(int degree, bool accept_degen,
+			    std::vector<shared_ptr<ParamSurface> >& sorted_sfs,
+			    bool& loft_sequence);
+
+    /// Second step of untrimRegular(). Replace the parametric volume
+    /// and the boundary faces, and reconnect with adjacent volumes
+    void setUntrimmedVolume(shared_ptr<ParamVolume> vol,
+			    std::vector<shared_ptr<ParamSurface> >& sorted_sfs,
+			    bool loft_sequence);
+
     /// Approximate parameter volume by a non-trimmed spline volume
     shared_ptr<ParamVolume> getRegParVol(int degree, int bd_cond[6][2],
 					 bool accept_degen = false);